@@ -56,34 +56,55 @@ namespace openvkl {
                                            float &sample,
                                            float &transmittance)
     {
-      t = hits.lower;
+      // the value selector is derived from the transfer function, so interval
+      // majorants bound the opacity within each interval
+      void *intervalIteratorBuffer =
+          alloca(vklGetIntervalIteratorSize(scene.volume));
+      VKLIntervalIterator iterator =
+          vklInitIntervalIterator(scene.volume,
+                                  (vkl_vec3f *)&ray.org,
+                                  (vkl_vec3f *)&ray.dir,
+                                  (vkl_range1f *)&hits,
+                                  scene.valueSelector,
+                                  intervalIteratorBuffer);
 
-      const float sigmaMax = sigmaTScale;
+      VKLInterval interval;
 
-      while (true) {
-        vec2f randomNumbers = rng.getFloats();
+      while (vklIterateInterval(iterator, &interval)) {
+        // use the local majorant rather than a global one, so that fewer
+        // tentative collisions are rejected in thin regions
+        const float sigmaMax = sigmaTScale * interval.majorant;
 
-        t = t + -std::log(1.f - randomNumbers.x) / sigmaMax;
+        if (sigmaMax <= 0.f)
+          continue;
 
-        if (t > hits.upper) {
-          transmittance = 1.f;
-          return false;
-        }
+        t = interval.tRange.lower;
+
+        while (true) {
+          vec2f randomNumbers = rng.getFloats();
+
+          t = t + -std::log(1.f - randomNumbers.x) / sigmaMax;
 
-        const vec3f c = ray.org + t * ray.dir;
-        sample        = vklComputeSample(scene.sampler, (const vkl_vec3f *)&c);
+          if (t > interval.tRange.upper)
+            break;
 
-        vec4f sampleColorAndOpacity = sampleTransferFunction(scene, sample);
+          const vec3f c = ray.org + t * ray.dir;
+          sample = vklComputeSample(scene.sampler, (const vkl_vec3f *)&c);
 
-        // sigmaT must be mono-chromatic for Woodcock sampling
-        const float sigmaTSample = sigmaMax * sampleColorAndOpacity.w;
+          vec4f sampleColorAndOpacity = sampleTransferFunction(scene, sample);
 
-        if (randomNumbers.y < sigmaTSample / sigmaMax)
-          break;
+          // sigmaT must be mono-chromatic for Woodcock sampling
+          const float sigmaTSample = sigmaTScale * sampleColorAndOpacity.w;
+
+          if (randomNumbers.y < sigmaTSample / sigmaMax) {
+            transmittance = 0.f;
+            return true;
+          }
+        }
       }
 
-      transmittance = 0.f;
-      return true;
+      transmittance = 1.f;
+      return false;
     }
 
     void DensityPathTracer::integrate(RNG &rng,
@@ -72,14 +72,15 @@ namespace openvkl {
 
         valueSelector = vklNewValueSelector(volume);
 
-        // set value selector value ranges based on transfer function positive
-        // opacity intervals
-        std::vector<range1f> valueRanges =
-            transferFunction.getPositiveOpacityValueRanges();
-
-        vklValueSelectorSetRanges(valueSelector,
-                                  valueRanges.size(),
-                                  (const vkl_range1f *)valueRanges.data());
+        // let the value selector derive value ranges from the transfer
+        // function opacities
+        std::vector<float> opacities = transferFunction.getOpacities();
+
+        vklValueSelectorSetOpacities(
+            valueSelector,
+            (const vkl_range1f *)&transferFunction.valueRange,
+            opacities.size(),
+            opacities.data());
 
         // if we have isovalues, set these values on the value selector
         if (!isoValues.empty()) {
@@ -1,8 +1,10 @@
 // Copyright 2019-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include "../common/allocation.h"
 #include "../common/logging.h"
 #include "../common/simd.h"
+#include "../common/tracing.h"
 #include "Driver.h"
 #include "openvkl/openvkl.h"
 #include "rkcommon/math/box.h"
@@ -84,6 +86,20 @@ extern "C" VKLData vklNewData(size_t numItems,
 }
 OPENVKL_CATCH_END(nullptr)
 
+extern "C" VKLData vklNewDataConverted(size_t numItems,
+                                       VKLDataType dataType,
+                                       const void *source,
+                                       VKLDataType sourceType,
+                                       size_t sourceByteStride)
+    OPENVKL_CATCH_BEGIN
+{
+  ASSERT_DRIVER();
+  VKLData data = openvkl::api::currentDriver().newDataConverted(
+      numItems, dataType, source, sourceType, sourceByteStride);
+  return data;
+}
+OPENVKL_CATCH_END(nullptr)
+
 ///////////////////////////////////////////////////////////////////////////////
 // Observer ///////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -178,6 +194,26 @@ extern "C" void vklDriverSetErrorFunc(VKLDriver driver,
 }
 OPENVKL_CATCH_END()
 
+extern "C" void vklDriverSetAllocator(VKLDriver driver,
+                                      VKLAllocateFunc allocateFunc,
+                                      VKLFreeFunc freeFunc,
+                                      void *userData) OPENVKL_CATCH_BEGIN
+{
+  THROW_IF_NULL_OBJECT(driver);
+  auto *object = (openvkl::api::Driver *)driver;
+
+  if (!allocateFunc != !freeFunc) {
+    throw std::runtime_error(
+        "vklDriverSetAllocator() requires both or neither of the allocate and "
+        "free functions");
+  }
+
+  object->allocateFunction  = allocateFunc;
+  object->freeFunction      = freeFunc;
+  object->allocatorUserData = userData;
+}
+OPENVKL_CATCH_END()
+
 extern "C" void vklDriverSetInt(VKLDriver driver,
                                 const char *name,
                                 int x) OPENVKL_CATCH_BEGIN
@@ -278,9 +314,17 @@ OPENVKL_CATCH_END()
 extern "C" void vklShutdown() OPENVKL_CATCH_BEGIN
 {
   openvkl::api::Driver::current = nullptr;
+  openvkl::tracing::setOutput("");
 }
 OPENVKL_CATCH_END()
 
+extern "C" VKLAllocationStats vklGetAllocationStats(
+    VKLAllocationCategory category) OPENVKL_CATCH_BEGIN
+{
+  return openvkl::allocation::stats(category);
+}
+OPENVKL_CATCH_END(VKLAllocationStats{})
+
 ///////////////////////////////////////////////////////////////////////////////
 // Interval iterator //////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -358,6 +402,33 @@ __define_vklInitIntervalIteratorN(16);
 
 #undef __define_vklInitIntervalIteratorN
 
+extern "C" void vklSetIntervalIteratorTRange(
+    VKLIntervalIterator iterator, const vkl_range1f *tRange) OPENVKL_CATCH_BEGIN
+{
+  openvkl::api::currentDriver().setIntervalIteratorTRange1(
+      iterator, reinterpret_cast<const vrange1fn<1> &>(*tRange));
+}
+OPENVKL_CATCH_END()
+
+#define __define_vklSetIntervalIteratorTRangeN(WIDTH)               \
+  extern "C" void vklSetIntervalIteratorTRange##WIDTH(              \
+      const int *valid,                                             \
+      VKLIntervalIterator##WIDTH iterator,                          \
+      const vkl_vrange1f##WIDTH *tRange) OPENVKL_CATCH_BEGIN        \
+  {                                                                 \
+    openvkl::api::currentDriver().setIntervalIteratorTRange##WIDTH( \
+        valid,                                                      \
+        iterator,                                                   \
+        reinterpret_cast<const vrange1fn<WIDTH> &>(*tRange));       \
+  }                                                                 \
+  OPENVKL_CATCH_END()
+
+__define_vklSetIntervalIteratorTRangeN(4);
+__define_vklSetIntervalIteratorTRangeN(8);
+__define_vklSetIntervalIteratorTRangeN(16);
+
+#undef __define_vklSetIntervalIteratorTRangeN
+
 extern "C" int vklIterateInterval(VKLIntervalIterator iterator,
                                   VKLInterval *interval) OPENVKL_CATCH_BEGIN
 {
@@ -389,6 +460,28 @@ __define_vklIterateIntervalN(16);
 
 #undef __define_vklIterateIntervalN
 
+extern "C" void vklIterateIntervalN(VKLVolume volume,
+                                    unsigned int N,
+                                    const vkl_vec3f *origin,
+                                    const vkl_vec3f *direction,
+                                    const vkl_range1f *tRange,
+                                    VKLValueSelector valueSelector,
+                                    VKLIntervalStreamFunc callback,
+                                    void *userData) OPENVKL_CATCH_BEGIN
+{
+  THROW_IF_NULL_OBJECT(volume);
+  openvkl::api::currentDriver().iterateIntervalN(
+      volume,
+      N,
+      reinterpret_cast<const vvec3fn<1> *>(origin),
+      reinterpret_cast<const vvec3fn<1> *>(direction),
+      reinterpret_cast<const vrange1fn<1> *>(tRange),
+      valueSelector,
+      callback,
+      userData);
+}
+OPENVKL_CATCH_END()
+
 ///////////////////////////////////////////////////////////////////////////////
 // Hit iterator ///////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -461,6 +554,33 @@ __define_vklInitHitIteratorN(16);
 
 #undef __define_vklInitHitIteratorN
 
+extern "C" void vklSetHitIteratorTRange(
+    VKLHitIterator iterator, const vkl_range1f *tRange) OPENVKL_CATCH_BEGIN
+{
+  openvkl::api::currentDriver().setHitIteratorTRange1(
+      iterator, reinterpret_cast<const vrange1fn<1> &>(*tRange));
+}
+OPENVKL_CATCH_END()
+
+#define __define_vklSetHitIteratorTRangeN(WIDTH)               \
+  extern "C" void vklSetHitIteratorTRange##WIDTH(              \
+      const int *valid,                                        \
+      VKLHitIterator##WIDTH iterator,                          \
+      const vkl_vrange1f##WIDTH *tRange) OPENVKL_CATCH_BEGIN   \
+  {                                                            \
+    openvkl::api::currentDriver().setHitIteratorTRange##WIDTH( \
+        valid,                                                 \
+        iterator,                                              \
+        reinterpret_cast<const vrange1fn<WIDTH> &>(*tRange));  \
+  }                                                            \
+  OPENVKL_CATCH_END()
+
+__define_vklSetHitIteratorTRangeN(4);
+__define_vklSetHitIteratorTRangeN(8);
+__define_vklSetHitIteratorTRangeN(16);
+
+#undef __define_vklSetHitIteratorTRangeN
+
 extern "C" int vklIterateHit(VKLHitIterator iterator,
                              VKLHit *hit) OPENVKL_CATCH_BEGIN
 {
@@ -488,6 +608,37 @@ __define_vklIterateHitN(16);
 
 #undef __define_vklIterateHitN
 
+extern "C" unsigned int vklIterateHits(VKLHitIterator iterator,
+                                       unsigned int maxHits,
+                                       VKLHit *hits) OPENVKL_CATCH_BEGIN
+{
+  return openvkl::api::currentDriver().iterateHits1(
+      iterator, maxHits, reinterpret_cast<vVKLHitN<1> *>(hits));
+}
+OPENVKL_CATCH_END(0u)
+
+extern "C" void vklIterateHitN(VKLVolume volume,
+                               unsigned int N,
+                               const vkl_vec3f *origin,
+                               const vkl_vec3f *direction,
+                               const vkl_range1f *tRange,
+                               VKLValueSelector valueSelector,
+                               VKLHitStreamFunc callback,
+                               void *userData) OPENVKL_CATCH_BEGIN
+{
+  THROW_IF_NULL_OBJECT(volume);
+  openvkl::api::currentDriver().iterateHitN(
+      volume,
+      N,
+      reinterpret_cast<const vvec3fn<1> *>(origin),
+      reinterpret_cast<const vvec3fn<1> *>(direction),
+      reinterpret_cast<const vrange1fn<1> *>(tRange),
+      valueSelector,
+      callback,
+      userData);
+}
+OPENVKL_CATCH_END()
+
 ///////////////////////////////////////////////////////////////////////////////
 // Module /////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -640,6 +791,21 @@ extern "C" void vklValueSelectorSetValues(VKLValueSelector valueSelector,
 }
 OPENVKL_CATCH_END()
 
+extern "C" void vklValueSelectorSetOpacities(VKLValueSelector valueSelector,
+                                             const vkl_range1f *valueRange,
+                                             size_t numOpacities,
+                                             const float *opacities)
+    OPENVKL_CATCH_BEGIN
+{
+  ASSERT_DRIVER();
+  openvkl::api::currentDriver().valueSelectorSetOpacities(
+      valueSelector,
+      reinterpret_cast<const range1f &>(*valueRange),
+      utility::ArrayView<const float>(
+          reinterpret_cast<const float *>(opacities), numOpacities));
+}
+OPENVKL_CATCH_END()
+
 ///////////////////////////////////////////////////////////////////////////////
 // Sampler ////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -752,6 +918,14 @@ extern "C" void vklComputeGradientN(VKLSampler sampler,
 }
 OPENVKL_CATCH_END()
 
+extern "C" VKLSamplerFunctions vklGetSamplerFunctions(VKLSampler sampler)
+    OPENVKL_CATCH_BEGIN
+{
+  THROW_IF_NULL_OBJECT(sampler);
+  return openvkl::api::currentDriver().getSamplerFunctions(sampler);
+}
+OPENVKL_CATCH_END(VKLSamplerFunctions{})
+
 ///////////////////////////////////////////////////////////////////////////////
 // Volume /////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -782,3 +956,18 @@ extern "C" vkl_range1f vklGetValueRange(VKLVolume volume) OPENVKL_CATCH_BEGIN
   return reinterpret_cast<const vkl_range1f &>(result);
 }
 OPENVKL_CATCH_END(vkl_range1f{rkcommon::math::nan})
+
+extern "C" VKLMemoryUsage vklGetVolumeMemoryUsage(VKLVolume volume)
+    OPENVKL_CATCH_BEGIN
+{
+  THROW_IF_NULL_OBJECT(volume);
+  return openvkl::api::currentDriver().getVolumeMemoryUsage(volume);
+}
+OPENVKL_CATCH_END(VKLMemoryUsage{})
+
+extern "C" VKLMemoryUsage vklGetTotalVolumeMemoryUsage() OPENVKL_CATCH_BEGIN
+{
+  ASSERT_DRIVER();
+  return openvkl::api::currentDriver().getTotalVolumeMemoryUsage();
+}
+OPENVKL_CATCH_END(VKLMemoryUsage{})
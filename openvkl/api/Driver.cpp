@@ -3,7 +3,9 @@
 
 #include "Driver.h"
 #include <sstream>
+#include "../common/allocation.h"
 #include "../common/objectFactory.h"
+#include "../common/tracing.h"
 #include "ispc_util_ispc.h"
 #include "rkcommon/tasking/tasking_system_init.h"
 #include "rkcommon/utility/StringManip.h"
@@ -156,6 +158,43 @@ namespace openvkl {
 
       tasking::initTaskingSystem(numThreads, flushDenormals);
 
+      // NUMA placement of library-owned buffers
+      auto OPENVKL_NUMA_POLICY =
+          utility::getEnvVar<std::string>("OPENVKL_NUMA_POLICY");
+
+      const std::string numaPolicy = OPENVKL_NUMA_POLICY.value_or(
+          getParam<std::string>("numaPolicy", "none"));
+
+      if (!allocation::setNumaPolicy(numaPolicy)) {
+        LogMessageStream(VKL_LOG_ERROR)
+            << "unknown numaPolicy value; must be none, firstTouch or "
+               "interleave";
+      }
+
+      // huge pages for large library-owned buffers
+      auto OPENVKL_HUGE_PAGES =
+          utility::getEnvVar<std::string>("OPENVKL_HUGE_PAGES");
+
+      const std::string hugePages = OPENVKL_HUGE_PAGES.value_or(
+          getParam<std::string>("hugePages", "none"));
+
+      if (!allocation::setHugePages(hugePages)) {
+        LogMessageStream(VKL_LOG_ERROR)
+            << "unknown hugePages value; must be none, transparent or "
+               "explicit";
+      }
+
+      // application allocator for library-owned buffers
+      allocation::setAllocator(
+          allocateFunction, freeFunction, allocatorUserData);
+
+      // trace output
+      auto OPENVKL_TRACE_OUTPUT =
+          utility::getEnvVar<std::string>("OPENVKL_TRACE_OUTPUT");
+
+      tracing::setOutput(OPENVKL_TRACE_OUTPUT.value_or(
+          getParam<std::string>("traceOutput", "")));
+
       committed = true;
     }
 
@@ -55,6 +55,10 @@ namespace openvkl {
       std::function<void(VKLError, const char *)> errorFunction{
           [](VKLError, const char *) {}};
 
+      VKLAllocateFunc allocateFunction{nullptr};
+      VKLFreeFunc freeFunction{nullptr};
+      void *allocatorUserData{nullptr};
+
       /////////////////////////////////////////////////////////////////////////
       // Data /////////////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -65,6 +69,12 @@ namespace openvkl {
                               VKLDataCreationFlags dataCreationFlags,
                               size_t byteStride) = 0;
 
+      virtual VKLData newDataConverted(size_t numItems,
+                                       VKLDataType dataType,
+                                       const void *source,
+                                       VKLDataType sourceType,
+                                       size_t sourceByteStride) = 0;
+
       /////////////////////////////////////////////////////////////////////////
       // Observer /////////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -153,6 +163,42 @@ namespace openvkl {
 
 #undef __define_iterateIntervalN
 
+      virtual void iterateIntervalN(VKLVolume volume,
+                                    unsigned int N,
+                                    const vvec3fn<1> *origin,
+                                    const vvec3fn<1> *direction,
+                                    const vrange1fn<1> *tRange,
+                                    VKLValueSelector valueSelector,
+                                    VKLIntervalStreamFunc callback,
+                                    void *userData) const
+      {
+        throw std::runtime_error(
+            "iterateIntervalN() not implemented on this driver");
+      }
+
+      virtual void setIntervalIteratorTRange1(
+          VKLIntervalIterator iterator, const vrange1fn<1> &tRange) const
+      {
+        throw std::runtime_error(
+            "setIntervalIteratorTRange1() not implemented on this driver");
+      }
+
+#define __define_setIntervalIteratorTRangeN(WIDTH)                            \
+  virtual void setIntervalIteratorTRange##WIDTH(                              \
+      const int *valid,                                                       \
+      VKLIntervalIterator##WIDTH iterator,                                    \
+      const vrange1fn<WIDTH> &tRange) const                                   \
+  {                                                                           \
+    throw std::runtime_error(                                                 \
+        "setIntervalIteratorTRange##WIDTH() not implemented on this driver"); \
+  }
+
+      __define_setIntervalIteratorTRangeN(4);
+      __define_setIntervalIteratorTRangeN(8);
+      __define_setIntervalIteratorTRangeN(16);
+
+#undef __define_setIntervalIteratorTRangeN
+
       /////////////////////////////////////////////////////////////////////////
       // Hit iterator /////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -229,6 +275,50 @@ namespace openvkl {
 
 #undef __define_iterateHitN
 
+      virtual unsigned int iterateHits1(VKLHitIterator iterator,
+                                        unsigned int maxHits,
+                                        vVKLHitN<1> *hits) const
+      {
+        throw std::runtime_error(
+            "iterateHits1() not implemented on this driver");
+      }
+
+      virtual void iterateHitN(VKLVolume volume,
+                               unsigned int N,
+                               const vvec3fn<1> *origin,
+                               const vvec3fn<1> *direction,
+                               const vrange1fn<1> *tRange,
+                               VKLValueSelector valueSelector,
+                               VKLHitStreamFunc callback,
+                               void *userData) const
+      {
+        throw std::runtime_error(
+            "iterateHitN() not implemented on this driver");
+      }
+
+      virtual void setHitIteratorTRange1(VKLHitIterator iterator,
+                                         const vrange1fn<1> &tRange) const
+      {
+        throw std::runtime_error(
+            "setHitIteratorTRange1() not implemented on this driver");
+      }
+
+#define __define_setHitIteratorTRangeN(WIDTH)                            \
+  virtual void setHitIteratorTRange##WIDTH(                              \
+      const int *valid,                                                  \
+      VKLHitIterator##WIDTH iterator,                                    \
+      const vrange1fn<WIDTH> &tRange) const                              \
+  {                                                                      \
+    throw std::runtime_error(                                            \
+        "setHitIteratorTRange##WIDTH() not implemented on this driver"); \
+  }
+
+      __define_setHitIteratorTRangeN(4);
+      __define_setHitIteratorTRangeN(8);
+      __define_setHitIteratorTRangeN(16);
+
+#undef __define_setHitIteratorTRangeN
+
       /////////////////////////////////////////////////////////////////////////
       // Module ///////////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -272,6 +362,11 @@ namespace openvkl {
           VKLValueSelector valueSelector,
           const utility::ArrayView<const float> &values) = 0;
 
+      virtual void valueSelectorSetOpacities(
+          VKLValueSelector valueSelector,
+          const range1f &valueRange,
+          const utility::ArrayView<const float> &opacities) = 0;
+
       /////////////////////////////////////////////////////////////////////////
       // Sampler //////////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -314,6 +409,12 @@ namespace openvkl {
                                     const vvec3fn<1> *objectCoordinates,
                                     vvec3fn<1> *gradients) = 0;
 
+      virtual VKLSamplerFunctions getSamplerFunctions(VKLSampler sampler)
+      {
+        throw std::runtime_error(
+            "getSamplerFunctions() not implemented on this driver");
+      }
+
       /////////////////////////////////////////////////////////////////////////
       // Volume ///////////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -324,6 +425,18 @@ namespace openvkl {
 
       virtual range1f getValueRange(VKLVolume volume) = 0;
 
+      virtual VKLMemoryUsage getVolumeMemoryUsage(VKLVolume volume)
+      {
+        throw std::runtime_error(
+            "getVolumeMemoryUsage() not implemented on this driver");
+      }
+
+      virtual VKLMemoryUsage getTotalVolumeMemoryUsage()
+      {
+        throw std::runtime_error(
+            "getTotalVolumeMemoryUsage() not implemented on this driver");
+      }
+
      private:
       bool committed = false;
     };
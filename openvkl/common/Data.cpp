@@ -2,10 +2,168 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Data.h"
-#include "rkcommon/memory/malloc.h"
+#include <algorithm>
+#include <cstring>
+#include "allocation.h"
+#include "tracing.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OPENVKL_STREAMING_STORES
+#endif
 
 namespace openvkl {
 
+  namespace {
+
+    // work granularity of parallel copies, in destination bytes
+    constexpr size_t copyChunkBytes = size_t(1) << 20;
+
+    /*
+     * Copy numBytes to dst, bypassing the cache where supported. This is used
+     * for large copies only, which would otherwise evict the whole cache.
+     */
+    void streamCopy(void *dst, const void *src, size_t numBytes)
+    {
+#ifdef OPENVKL_STREAMING_STORES
+      char *d       = static_cast<char *>(dst);
+      const char *s = static_cast<const char *>(src);
+
+      const size_t head =
+          std::min(numBytes, (16 - (reinterpret_cast<uintptr_t>(d) & 15)) & 15);
+      memcpy(d, s, head);
+      d += head;
+      s += head;
+      numBytes -= head;
+
+      for (; numBytes >= 64; numBytes -= 64, d += 64, s += 64) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(s + 0));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(s + 16));
+        const __m128i c = _mm_loadu_si128((const __m128i *)(s + 32));
+        const __m128i e = _mm_loadu_si128((const __m128i *)(s + 48));
+        _mm_stream_si128((__m128i *)(d + 0), a);
+        _mm_stream_si128((__m128i *)(d + 16), b);
+        _mm_stream_si128((__m128i *)(d + 32), c);
+        _mm_stream_si128((__m128i *)(d + 48), e);
+      }
+
+      memcpy(d, s, numBytes);
+      _mm_sfence();
+#else
+      memcpy(dst, src, numBytes);
+#endif
+    }
+
+    template <size_t N>
+    void copyStridedFixed(char *dst,
+                          const char *src,
+                          size_t byteStride,
+                          size_t numItems)
+    {
+      for (size_t i = 0; i < numItems; i++)
+        memcpy(dst + i * N, src + i * byteStride, N);
+    }
+
+    /*
+     * Compact numItems strided elements of the given size into dst. Common
+     * element sizes get a fixed-size copy the compiler can inline.
+     */
+    void copyStrided(char *dst,
+                     const char *src,
+                     size_t byteStride,
+                     size_t elementSize,
+                     size_t numItems)
+    {
+      switch (elementSize) {
+      case 1:
+        return copyStridedFixed<1>(dst, src, byteStride, numItems);
+      case 2:
+        return copyStridedFixed<2>(dst, src, byteStride, numItems);
+      case 4:
+        return copyStridedFixed<4>(dst, src, byteStride, numItems);
+      case 8:
+        return copyStridedFixed<8>(dst, src, byteStride, numItems);
+      case 12:
+        return copyStridedFixed<12>(dst, src, byteStride, numItems);
+      case 16:
+        return copyStridedFixed<16>(dst, src, byteStride, numItems);
+      default:
+        for (size_t i = 0; i < numItems; i++)
+          memcpy(dst + i * elementSize, src + i * byteStride, elementSize);
+      }
+    }
+
+    template <typename TO, typename FROM>
+    void convertStrided(char *dst,
+                        const char *src,
+                        size_t byteStride,
+                        size_t numItems)
+    {
+      TO *d = reinterpret_cast<TO *>(dst);
+      for (size_t i = 0; i < numItems; i++) {
+        FROM value;
+        memcpy(&value, src + i * byteStride, sizeof(FROM));
+        d[i] = static_cast<TO>(value);
+      }
+    }
+
+    bool supportsConversion(VKLDataType dataType, VKLDataType sourceType)
+    {
+      return dataType == sourceType ||
+             (dataType == VKL_FLOAT && sourceType == VKL_DOUBLE);
+    }
+
+    /*
+     * Copy numItems elements of sourceType from source into the compact
+     * array dst of dataType, converting elements if the types differ. Large
+     * copies are split into chunks that run in parallel.
+     */
+    void copyItems(char *dst,
+                   VKLDataType dataType,
+                   const char *source,
+                   VKLDataType sourceType,
+                   size_t byteStride,
+                   size_t numItems)
+    {
+      const size_t elementSize = sizeOf(dataType);
+      const size_t numBytes    = numItems * elementSize;
+
+      auto copyRange = [&](size_t begin, size_t end, bool streaming) {
+        char *d       = dst + begin * elementSize;
+        const char *s = source + begin * byteStride;
+        const size_t n = end - begin;
+
+        if (dataType != sourceType)
+          convertStrided<float, double>(d, s, byteStride, n);
+        else if (byteStride != elementSize)
+          copyStrided(d, s, byteStride, elementSize, n);
+        else if (streaming)
+          streamCopy(d, s, n * elementSize);
+        else
+          memcpy(d, s, n * elementSize);
+      };
+
+      // copying in parallel also spreads the first touch of the new pages
+      // over the NUMA nodes of all threads
+      if (numBytes < allocation::parallelInitThreshold()) {
+        copyRange(0, numItems, false);
+        return;
+      }
+
+      const size_t chunkItems =
+          std::max(copyChunkBytes / elementSize, size_t(1));
+      const size_t numChunks  = (numItems + chunkItems - 1) / chunkItems;
+
+      tracing::parallel_for("copyData", numChunks, [&](size_t chunk) {
+        const size_t begin = chunk * chunkItems;
+        const size_t end   = std::min(begin + chunkItems, numItems);
+        copyRange(begin, end, true);
+      });
+    }
+
+  }  // namespace
+
   ispc::Data1D Data::emptyData1D;
 
   Data::Data(size_t numItems,
@@ -33,47 +191,60 @@ namespace openvkl {
 
     if (dataCreationFlags == VKL_DATA_DEFAULT) {
       // copy source data into naturally-strided (compact) array
-      const size_t naturalByteStride = sizeOf(dataType);
-      const size_t numBytes          = numItems * naturalByteStride;
-
-      void *buffer = rkcommon::memory::alignedMalloc(numBytes + 16);
-
-      if (buffer == nullptr) {
-        throw std::bad_alloc();
-      }
-
-      if (byteStride == naturalByteStride) {
-        memcpy(buffer, source, numBytes);
-      } else {
-        for (size_t i = 0; i < numItems; i++) {
-          const char *src = (const char *)source + i * byteStride;
-          char *dst       = (char *)buffer + i * naturalByteStride;
-          memcpy(dst, src, sizeOf(dataType));
-        }
-      }
-
-      addr       = (char *)buffer;
-      byteStride = naturalByteStride;
+      allocateCompact();
+      copyItems(addr,
+                dataType,
+                (const char *)source,
+                dataType,
+                byteStride,
+                numItems);
+      byteStride = sizeOf(dataType);
     } else if (dataCreationFlags == VKL_DATA_SHARED_BUFFER) {
       addr = (char *)source;
     } else {
       throw std::runtime_error("VKLData: unknown data creation flags provided");
     }
 
-    managedObjectType = VKL_DATA;
-    if (isManagedObject(dataType)) {
-      ManagedObject **child = (ManagedObject **)addr;
-      for (uint32_t i = 0; i < numItems; i++) {
-        if (child[i])
-          child[i]->refInc();
-      }
+    init();
+  }
+
+  Data::Data(size_t numItems,
+             VKLDataType dataType,
+             const void *source,
+             VKLDataType sourceType,
+             size_t sourceByteStride)
+      : numItems(numItems),
+        dataType(dataType),
+        dataCreationFlags(VKL_DATA_DEFAULT),
+        byteStride(sizeOf(dataType))
+  {
+    if (numItems == 0) {
+      throw std::out_of_range("VKLData: numItems must be positive");
     }
 
-    // set ISPC-side proxy
-    ispc.addr       = reinterpret_cast<decltype(ispc.addr)>(addr);
-    ispc.byteStride = byteStride;
-    ispc.numItems   = numItems;
-    ispc.compact    = compact();
+    if (!source) {
+      throw std::runtime_error("VKLData: source cannot be NULL");
+    }
+
+    if (!supportsConversion(dataType, sourceType)) {
+      throw std::runtime_error(std::string("VKLData: unsupported conversion ") +
+                               "from " + stringFor(sourceType) + " to " +
+                               stringFor(dataType));
+    }
+
+    if (sourceByteStride == 0) {
+      sourceByteStride = sizeOf(sourceType);
+    }
+
+    allocateCompact();
+    copyItems(addr,
+              dataType,
+              (const char *)source,
+              sourceType,
+              sourceByteStride,
+              numItems);
+
+    init();
   }
 
   Data::~Data()
@@ -87,7 +258,7 @@ namespace openvkl {
     }
 
     if (!(dataCreationFlags & VKL_DATA_SHARED_BUFFER)) {
-      rkcommon::memory::alignedFree(addr);
+      allocation::deallocate(addr);
     }
   }
 
@@ -106,4 +277,29 @@ namespace openvkl {
     return byteStride == sizeOf(dataType);
   }
 
+  void Data::allocateCompact()
+  {
+    const size_t numBytes = numItems * sizeOf(dataType);
+
+    addr = (char *)allocation::allocate(numBytes + 16, VKL_ALLOCATION_DATA);
+  }
+
+  void Data::init()
+  {
+    managedObjectType = VKL_DATA;
+    if (isManagedObject(dataType)) {
+      ManagedObject **child = (ManagedObject **)addr;
+      for (uint32_t i = 0; i < numItems; i++) {
+        if (child[i])
+          child[i]->refInc();
+      }
+    }
+
+    // set ISPC-side proxy
+    ispc.addr       = reinterpret_cast<decltype(ispc.addr)>(addr);
+    ispc.byteStride = byteStride;
+    ispc.numItems   = numItems;
+    ispc.compact    = compact();
+  }
+
 }  // namespace openvkl
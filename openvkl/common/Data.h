@@ -33,6 +33,14 @@ namespace openvkl {
          VKLDataCreationFlags dataCreationFlags,
          size_t byteStride);
 
+    // creates a compact, owned copy of the source data, converting elements
+    // from sourceType to dataType
+    Data(size_t numItems,
+         VKLDataType dataType,
+         const void *source,
+         VKLDataType sourceType,
+         size_t sourceByteStride);
+
     virtual ~Data() override;
 
     virtual std::string toString() const override;
@@ -61,6 +69,10 @@ namespace openvkl {
 
    protected:
     char *addr;
+
+   private:
+    void allocateCompact();
+    void init();
   };
 
   // Inlined definitions //////////////////////////////////////////////////////
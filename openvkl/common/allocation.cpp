@@ -0,0 +1,458 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "allocation.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <vector>
+#include "logging.h"
+#include "rkcommon/memory/malloc.h"
+#include "tracing.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace openvkl {
+  namespace allocation {
+
+    namespace {
+
+      std::atomic<NumaPolicy> policy{NumaPolicy::None};
+      std::atomic<HugePages> hugePagesPolicy{HugePages::None};
+
+      // smaller buffers are neither placed explicitly nor initialized in
+      // parallel; this is also the work granularity of parallel initialization
+      constexpr size_t largeBufferBytes = size_t(1) << 20;
+
+      // without a NUMA policy, only parallelize initialization where it pays
+      // off in bandwidth
+      constexpr size_t defaultParallelInitBytes = size_t(16) << 20;
+
+      constexpr size_t pageBytes     = 4096;
+      constexpr size_t hugePageBytes = size_t(2) << 20;
+
+      struct Allocator
+      {
+        VKLAllocateFunc allocateFunc{nullptr};
+        VKLFreeFunc freeFunc{nullptr};
+        void *userData{nullptr};
+      };
+
+      std::mutex allocatorMutex;
+      Allocator allocator;
+
+      Allocator currentAllocator()
+      {
+        std::lock_guard<std::mutex> lock(allocatorMutex);
+        return allocator;
+      }
+
+      struct alignas(64) Header
+      {
+        void *base;          // start of the underlying allocation
+        size_t mappedBytes;  // length of the mapping if mmap()ed, else 0
+        size_t numBytes;
+        VKLAllocationCategory category;
+        bool hugePages;
+
+        // set if the buffer came from an application allocator
+        VKLFreeFunc freeFunc;
+        void *userData;
+      };
+
+      static_assert(sizeof(Header) == 64, "Header must preserve alignment");
+
+      struct CategoryStats
+      {
+        std::atomic<size_t> numBuffers{0};
+        std::atomic<size_t> bytes{0};
+        std::atomic<size_t> numHugePageBuffers{0};
+        std::atomic<size_t> hugePageBytes{0};
+      };
+
+      CategoryStats categoryStats[VKL_ALLOCATION_NUM_CATEGORIES];
+
+      void addStats(const Header &header)
+      {
+        CategoryStats &s = categoryStats[header.category];
+
+        s.numBuffers += 1;
+        s.bytes += header.numBytes;
+
+        if (header.hugePages) {
+          s.numHugePageBuffers += 1;
+          s.hugePageBytes += header.numBytes;
+        }
+      }
+
+      void removeStats(const Header &header)
+      {
+        CategoryStats &s = categoryStats[header.category];
+
+        s.numBuffers -= 1;
+        s.bytes -= header.numBytes;
+
+        if (header.hugePages) {
+          s.numHugePageBuffers -= 1;
+          s.hugePageBytes -= header.numBytes;
+        }
+      }
+
+#if defined(__linux__) && defined(SYS_mbind)
+
+      /*
+       * The node mask of all online NUMA nodes, empty if this is not a NUMA
+       * system.
+       */
+      const std::vector<unsigned long> &onlineNodeMask()
+      {
+        static const std::vector<unsigned long> mask = []() {
+          std::vector<unsigned long> mask;
+
+          // a list of node ranges, e.g. "0-1,3"
+          std::ifstream in("/sys/devices/system/node/online");
+          std::string list;
+          if (!(in >> list))
+            return mask;
+
+          const size_t bitsPerWord = 8 * sizeof(unsigned long);
+          int numNodes             = 0;
+
+          const char *s = list.c_str();
+          while (*s) {
+            char *end;
+            const long first = std::strtol(s, &end, 10);
+            long last        = first;
+            if (*end == '-')
+              last = std::strtol(end + 1, &end, 10);
+
+            for (size_t node = first; node <= size_t(last); node++) {
+              if (mask.size() <= node / bitsPerWord)
+                mask.resize(node / bitsPerWord + 1, 0);
+              mask[node / bitsPerWord] |= 1ul << (node % bitsPerWord);
+              numNodes++;
+            }
+
+            s = (*end == ',') ? end + 1 : end;
+            if (end == s && *s)
+              break;
+          }
+
+          if (numNodes < 2)
+            mask.clear();
+
+          return mask;
+        }();
+
+        return mask;
+      }
+
+      bool interleaveSupported()
+      {
+        return !onlineNodeMask().empty();
+      }
+
+      void interleave(void *ptr, size_t numBytes)
+      {
+        const std::vector<unsigned long> &mask = onlineNodeMask();
+        if (mask.empty())
+          return;
+
+        const int MPOL_INTERLEAVE_ = 3;
+        const unsigned long maxNode = mask.size() * 8 * sizeof(unsigned long);
+
+        // placement is a hint; on failure we fall back to first touch
+        syscall(SYS_mbind,
+                ptr,
+                numBytes,
+                MPOL_INTERLEAVE_,
+                mask.data(),
+                maxNode + 1,
+                0);
+      }
+
+#else
+
+      bool interleaveSupported()
+      {
+        return false;
+      }
+
+      void interleave(void *, size_t) {}
+
+#endif
+
+      /*
+       * Map numBytes backed by explicit huge pages. Returns null if no huge
+       * pages are available.
+       */
+      void *mapHugePages(size_t numBytes)
+      {
+#if defined(__linux__) && defined(MAP_HUGETLB)
+        void *ptr = mmap(nullptr,
+                         numBytes,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                         -1,
+                         0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+#else
+        return nullptr;
+#endif
+      }
+
+      void unmapHugePages(void *ptr, size_t numBytes)
+      {
+#if defined(__linux__)
+        munmap(ptr, numBytes);
+#endif
+      }
+
+      /*
+       * Request transparent huge pages for the given 2 MB aligned range.
+       */
+      bool adviseHugePages(void *ptr, size_t numBytes)
+      {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        return madvise(ptr, numBytes, MADV_HUGEPAGE) == 0;
+#else
+        return false;
+#endif
+      }
+
+    }  // namespace
+
+    bool setNumaPolicy(const std::string &name)
+    {
+      NumaPolicy p;
+
+      if (name == "none")
+        p = NumaPolicy::None;
+      else if (name == "firstTouch")
+        p = NumaPolicy::FirstTouch;
+      else if (name == "interleave")
+        p = NumaPolicy::Interleave;
+      else
+        return false;
+
+      if (p == NumaPolicy::Interleave && !interleaveSupported()) {
+        LogMessageStream(VKL_LOG_DEBUG)
+            << "NUMA interleaving is not available on this system, using "
+               "firstTouch placement";
+      }
+
+      policy = p;
+      return true;
+    }
+
+    bool setHugePages(const std::string &name)
+    {
+      HugePages p;
+
+      if (name == "none")
+        p = HugePages::None;
+      else if (name == "transparent")
+        p = HugePages::Transparent;
+      else if (name == "explicit")
+        p = HugePages::Explicit;
+      else
+        return false;
+
+#if !defined(__linux__)
+      if (p != HugePages::None) {
+        LogMessageStream(VKL_LOG_DEBUG)
+            << "huge pages are not supported on this system";
+      }
+#endif
+
+      hugePagesPolicy = p;
+      return true;
+    }
+
+    NumaPolicy numaPolicy()
+    {
+      return policy.load(std::memory_order_relaxed);
+    }
+
+    HugePages hugePages()
+    {
+      return hugePagesPolicy.load(std::memory_order_relaxed);
+    }
+
+    void setAllocator(VKLAllocateFunc allocateFunc,
+                      VKLFreeFunc freeFunc,
+                      void *userData)
+    {
+      if (!allocateFunc != !freeFunc) {
+        throw std::runtime_error(
+            "allocate and free functions must either both be set or both be "
+            "null");
+      }
+
+      std::lock_guard<std::mutex> lock(allocatorMutex);
+
+      allocator.allocateFunc = allocateFunc;
+      allocator.freeFunc     = freeFunc;
+      allocator.userData     = allocateFunc ? userData : nullptr;
+    }
+
+    size_t parallelInitThreshold()
+    {
+      return numaPolicy() == NumaPolicy::None ? defaultParallelInitBytes
+                                              : largeBufferBytes;
+    }
+
+    void *allocate(size_t numBytes, VKLAllocationCategory category)
+    {
+      const size_t totalBytes = numBytes + sizeof(Header);
+
+      const Allocator custom = currentAllocator();
+
+      if (custom.allocateFunc) {
+        void *base = custom.allocateFunc(
+            custom.userData, totalBytes, alignof(Header), category);
+
+        if (base == nullptr) {
+          throw std::bad_alloc();
+        }
+
+        Header *header      = static_cast<Header *>(base);
+        header->base        = base;
+        header->mappedBytes = 0;
+        header->numBytes    = numBytes;
+        header->category    = category;
+        header->hugePages   = false;
+        header->freeFunc    = custom.freeFunc;
+        header->userData    = custom.userData;
+
+        addStats(*header);
+
+        return header + 1;
+      }
+
+      const HugePages hugePagesMode = hugePages();
+      const bool wantHugePages =
+          hugePagesMode != HugePages::None && totalBytes >= hugePageBytes;
+
+      const bool interleaved = numaPolicy() == NumaPolicy::Interleave &&
+                               totalBytes >= largeBufferBytes;
+
+      void *base         = nullptr;
+      size_t mappedBytes = 0;
+      bool gotHugePages  = false;
+
+      if (wantHugePages && hugePagesMode == HugePages::Explicit) {
+        mappedBytes =
+            (totalBytes + hugePageBytes - 1) / hugePageBytes * hugePageBytes;
+        base = mapHugePages(mappedBytes);
+
+        if (base)
+          gotHugePages = true;
+        else
+          mappedBytes = 0;
+      }
+
+      if (!base) {
+        // huge pages and memory policies apply to whole, aligned pages
+        const size_t alignment =
+            wantHugePages ? hugePageBytes : (interleaved ? pageBytes : 64);
+
+        base = rkcommon::memory::alignedMalloc(totalBytes, alignment);
+
+        if (base == nullptr) {
+          throw std::bad_alloc();
+        }
+
+        if (wantHugePages) {
+          gotHugePages = adviseHugePages(
+              base, totalBytes / hugePageBytes * hugePageBytes);
+        }
+      }
+
+      if (interleaved)
+        interleave(base, totalBytes);
+
+      Header *header      = static_cast<Header *>(base);
+      header->base        = base;
+      header->mappedBytes = mappedBytes;
+      header->numBytes    = numBytes;
+      header->category    = category;
+      header->hugePages   = gotHugePages;
+      header->freeFunc    = nullptr;
+      header->userData    = nullptr;
+
+      addStats(*header);
+
+      return header + 1;
+    }
+
+    void *allocateZeroed(size_t numBytes, VKLAllocationCategory category)
+    {
+      char *ptr = static_cast<char *>(allocate(numBytes, category));
+
+      if (numBytes < parallelInitThreshold()) {
+        std::memset(ptr, 0, numBytes);
+        return ptr;
+      }
+
+      const size_t numChunks =
+          (numBytes + largeBufferBytes - 1) / largeBufferBytes;
+
+      tracing::parallel_for("zeroBuffer", numChunks, [&](size_t chunk) {
+        const size_t begin = chunk * largeBufferBytes;
+        const size_t end   = std::min(begin + largeBufferBytes, numBytes);
+        std::memset(ptr + begin, 0, end - begin);
+      });
+
+      return ptr;
+    }
+
+    void deallocate(void *ptr)
+    {
+      if (!ptr)
+        return;
+
+      const Header header = *(static_cast<Header *>(ptr) - 1);
+
+      removeStats(header);
+
+      if (header.freeFunc) {
+        header.freeFunc(header.userData,
+                        header.base,
+                        header.numBytes + sizeof(Header),
+                        header.category);
+      } else if (header.mappedBytes) {
+        unmapHugePages(header.base, header.mappedBytes);
+      } else {
+        rkcommon::memory::alignedFree(header.base);
+      }
+    }
+
+    VKLAllocationStats stats(VKLAllocationCategory category)
+    {
+      VKLAllocationStats result{0, 0, 0, 0};
+
+      if (category >= VKL_ALLOCATION_NUM_CATEGORIES)
+        return result;
+
+      const CategoryStats &s = categoryStats[category];
+
+      result.numBuffers         = s.numBuffers;
+      result.bytes              = s.bytes;
+      result.numHugePageBuffers = s.numHugePageBuffers;
+      result.hugePageBytes      = s.hugePageBytes;
+
+      return result;
+    }
+
+  }  // namespace allocation
+}  // namespace openvkl
@@ -0,0 +1,107 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include "VKLCommon.h"
+#include "openvkl/openvkl.h"
+
+/*
+ * Allocation of library-owned buffers (data arrays, VDB levels, grid
+ * accelerators, ISPC-side objects).
+ *
+ * On multi-socket systems, pages are placed on the NUMA node of the thread
+ * that first touches them. The NUMA policy controls how buffers are placed:
+ *
+ *   none        - buffers are placed by whichever thread initializes them
+ *   firstTouch  - large buffers are initialized by parallel tasks, so that
+ *                 their pages are spread over the nodes of all threads
+ *   interleave  - pages of large buffers are interleaved over all NUMA
+ *                 nodes (Linux only), and initialized in parallel
+ *
+ * Independently, buffers of at least 2 MB can be backed by huge pages to
+ * reduce TLB misses in random access:
+ *
+ *   none        - regular pages
+ *   transparent - transparent huge pages are requested with madvise()
+ *   explicit    - huge pages are mapped with MAP_HUGETLB, falling back to
+ *                 transparent huge pages if none are available
+ *
+ * The application may install its own allocator, in which case it also
+ * decides on placement, and neither policy is applied.
+ *
+ * Every buffer carries a small header, so that deallocate() and the
+ * allocation statistics need no lookup. The header also records the free
+ * function of the allocator that provided the buffer, so buffers outlive
+ * allocator changes.
+ */
+namespace openvkl {
+  namespace allocation {
+
+    enum class NumaPolicy
+    {
+      None,
+      FirstTouch,
+      Interleave
+    };
+
+    enum class HugePages
+    {
+      None,
+      Transparent,
+      Explicit
+    };
+
+    /*
+     * Set the policies by name. Returns false, leaving the policy unchanged,
+     * if the name is not known.
+     */
+    OPENVKL_CORE_INTERFACE bool setNumaPolicy(const std::string &name);
+    OPENVKL_CORE_INTERFACE bool setHugePages(const std::string &name);
+
+    OPENVKL_CORE_INTERFACE NumaPolicy numaPolicy();
+    OPENVKL_CORE_INTERFACE HugePages hugePages();
+
+    /*
+     * Install an application allocator for subsequent allocations. Null
+     * functions restore the default allocator. Throws if only one of the
+     * functions is null.
+     */
+    OPENVKL_CORE_INTERFACE void setAllocator(VKLAllocateFunc allocateFunc,
+                                             VKLFreeFunc freeFunc,
+                                             void *userData);
+
+    /*
+     * Buffers at least this large are initialized in parallel.
+     */
+    OPENVKL_CORE_INTERFACE size_t parallelInitThreshold();
+
+    /*
+     * Allocate an uninitialized, 64 byte aligned buffer, from the application
+     * allocator if one is installed, or else placed according to the current
+     * policies. Throws std::bad_alloc on failure.
+     */
+    OPENVKL_CORE_INTERFACE void *allocate(size_t numBytes,
+                                          VKLAllocationCategory category);
+
+    /*
+     * Like allocate(), but zero-initialized (in parallel for large buffers).
+     */
+    OPENVKL_CORE_INTERFACE void *allocateZeroed(
+        size_t numBytes, VKLAllocationCategory category);
+
+    /*
+     * Free a buffer returned by allocate(). Null pointers are ignored.
+     */
+    OPENVKL_CORE_INTERFACE void deallocate(void *ptr);
+
+    /*
+     * Statistics over the currently allocated buffers of a category.
+     */
+    OPENVKL_CORE_INTERFACE VKLAllocationStats
+    stats(VKLAllocationCategory category);
+
+  }  // namespace allocation
+}  // namespace openvkl
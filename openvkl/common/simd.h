@@ -217,6 +217,7 @@ namespace openvkl {
     vrange1fn<W> tRange;
     vrange1fn<W> valueRange;
     vfloatn<W> nominalDeltaT;
+    vfloatn<W> majorant;
 
     vVKLIntervalN<W>()
     {
@@ -230,7 +231,8 @@ namespace openvkl {
     vVKLIntervalN<W>(const vVKLIntervalN<W> &v)
         : tRange(v.tRange),
           valueRange(v.valueRange),
-          nominalDeltaT(v.nominalDeltaT)
+          nominalDeltaT(v.nominalDeltaT),
+          majorant(v.majorant)
     {
     }
   };
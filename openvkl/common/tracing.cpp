@@ -0,0 +1,188 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tracing.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "logging.h"
+
+namespace openvkl {
+  namespace tracing {
+
+    namespace {
+
+      using Clock = std::chrono::steady_clock;
+
+      struct Event
+      {
+        const char *name;
+        const char *category;
+        int64_t begin;
+        int64_t end;
+      };
+
+      // each thread appends to its own buffer, so recording threads do not
+      // contend; the lock is only shared with writeTrace()
+      struct ThreadBuffer
+      {
+        int tid{0};
+        std::mutex mutex;
+        std::vector<Event> events;
+      };
+
+      struct Recorder
+      {
+        ~Recorder();
+
+        ThreadBuffer &threadBuffer();
+
+        // must be called with mutex held
+        bool writeTrace();
+
+        std::atomic<bool> enabled{false};
+        const Clock::time_point epoch{Clock::now()};
+
+        std::mutex mutex;
+        std::string filename;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+      };
+
+      Recorder &recorder()
+      {
+        static Recorder instance;
+        return instance;
+      }
+
+      Recorder::~Recorder()
+      {
+        // write the trace of applications that exit without vklShutdown()
+        std::lock_guard<std::mutex> lock(mutex);
+        writeTrace();
+      }
+
+      ThreadBuffer &Recorder::threadBuffer()
+      {
+        thread_local ThreadBuffer *buffer = nullptr;
+
+        if (!buffer) {
+          std::lock_guard<std::mutex> lock(mutex);
+          buffers.emplace_back(new ThreadBuffer);
+          buffer      = buffers.back().get();
+          buffer->tid = static_cast<int>(buffers.size());
+        }
+
+        return *buffer;
+      }
+
+      void writeString(std::ostream &out, const char *s)
+      {
+        out << '"';
+        for (; *s; s++) {
+          if (*s == '"' || *s == '\\')
+            out << '\\';
+          out << *s;
+        }
+        out << '"';
+      }
+
+      bool Recorder::writeTrace()
+      {
+        if (filename.empty())
+          return true;
+
+        std::ofstream out(filename);
+        out << std::fixed << std::setprecision(3);
+
+        out << "{\"traceEvents\":[";
+
+        bool first = true;
+
+        for (const auto &buffer : buffers) {
+          std::lock_guard<std::mutex> lock(buffer->mutex);
+
+          if (buffer->events.empty())
+            continue;
+
+          out << (first ? "\n" : ",\n");
+          first = false;
+
+          out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+              << buffer->tid << ",\"args\":{\"name\":\"openvkl thread "
+              << buffer->tid << "\"}}";
+
+          // chrome trace timestamps are in microseconds
+          for (const Event &e : buffer->events) {
+            out << ",\n{\"name\":";
+            writeString(out, e.name);
+            out << ",\"cat\":";
+            writeString(out, e.category);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->tid
+                << ",\"ts\":" << e.begin * 1e-3
+                << ",\"dur\":" << (e.end - e.begin) * 1e-3 << "}";
+          }
+
+          buffer->events.clear();
+        }
+
+        out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+        return bool(out);
+      }
+
+    }  // namespace
+
+    bool enabled()
+    {
+      return recorder().enabled.load(std::memory_order_relaxed);
+    }
+
+    void setOutput(const std::string &filename)
+    {
+      Recorder &r = recorder();
+
+      std::lock_guard<std::mutex> lock(r.mutex);
+
+      if (filename == r.filename)
+        return;
+
+      r.enabled = false;
+
+      if (!r.writeTrace()) {
+        LogMessageStream(VKL_LOG_WARNING)
+            << "could not write trace file " << r.filename;
+      }
+
+      r.filename = filename;
+      r.enabled  = !filename.empty();
+    }
+
+    int64_t now()
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 Clock::now() - recorder().epoch)
+          .count();
+    }
+
+    void recordEvent(const char *name,
+                     const char *category,
+                     int64_t begin,
+                     int64_t end)
+    {
+      Recorder &r = recorder();
+
+      if (!r.enabled.load(std::memory_order_relaxed))
+        return;
+
+      ThreadBuffer &buffer = r.threadBuffer();
+
+      std::lock_guard<std::mutex> lock(buffer.mutex);
+      buffer.events.push_back(Event{name, category, begin, end});
+    }
+
+  }  // namespace tracing
+}  // namespace openvkl
@@ -0,0 +1,127 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include "VKLCommon.h"
+#include "rkcommon/tasking/parallel_for.h"
+
+/*
+ * Trace events for profiling commits and bulk calls.
+ *
+ * Events are recorded while a trace output file is set (see the "traceOutput"
+ * driver parameter), and written as Chrome trace event JSON when the output
+ * changes or on shutdown. The file can be opened in Perfetto or
+ * chrome://tracing. While tracing is off, a scope costs a single check.
+ *
+ * Event names and categories are not copied, and must be string literals.
+ */
+namespace openvkl {
+  namespace tracing {
+
+    /*
+     * True if trace events are currently being recorded.
+     */
+    OPENVKL_CORE_INTERFACE bool enabled();
+
+    /*
+     * Start recording to the given file. Events recorded for a previous file
+     * are written out first. An empty filename stops recording.
+     */
+    OPENVKL_CORE_INTERFACE void setOutput(const std::string &filename);
+
+    /*
+     * Nanoseconds since tracing was first used.
+     */
+    OPENVKL_CORE_INTERFACE int64_t now();
+
+    OPENVKL_CORE_INTERFACE void recordEvent(const char *name,
+                                            const char *category,
+                                            int64_t begin,
+                                            int64_t end);
+
+    /*
+     * Records an event from construction to destruction. Sequential phases
+     * of a function can share one scope through next().
+     */
+    struct Scope
+    {
+      explicit Scope(const char *name, const char *category = "openvkl");
+      ~Scope();
+
+      Scope(const Scope &) = delete;
+      Scope &operator=(const Scope &) = delete;
+
+      /*
+       * End the current event, and begin a new one with the given name.
+       */
+      void next(const char *name);
+
+     private:
+      const char *name{nullptr};
+      const char *category{nullptr};
+      int64_t begin{-1};
+    };
+
+    /*
+     * Like tasking::parallel_for(), but records one event per chunk of tasks
+     * while tracing, so that the timeline shows how the work was spread over
+     * threads.
+     */
+    template <typename TASK_T>
+    inline void parallel_for(const char *name, size_t numTasks, TASK_T &&task);
+
+    // Inlined definitions ////////////////////////////////////////////////////
+
+    inline Scope::Scope(const char *name, const char *category)
+        : name(name), category(category)
+    {
+      if (enabled())
+        begin = now();
+    }
+
+    inline Scope::~Scope()
+    {
+      if (begin >= 0)
+        recordEvent(name, category, begin, now());
+    }
+
+    inline void Scope::next(const char *name)
+    {
+      if (begin >= 0) {
+        const int64_t end = now();
+        recordEvent(this->name, category, begin, end);
+        begin = end;
+      }
+
+      this->name = name;
+    }
+
+    template <typename TASK_T>
+    inline void parallel_for(const char *name, size_t numTasks, TASK_T &&task)
+    {
+      if (!enabled()) {
+        rkcommon::tasking::parallel_for(numTasks, std::forward<TASK_T>(task));
+        return;
+      }
+
+      // enough chunks to balance the load, few enough to keep traces small
+      const size_t numChunks = std::min(numTasks, size_t(256));
+
+      rkcommon::tasking::parallel_for(numChunks, [&](size_t chunk) {
+        Scope scope(name, "task");
+
+        const size_t begin = numTasks * chunk / numChunks;
+        const size_t end   = numTasks * (chunk + 1) / numChunks;
+
+        for (size_t i = begin; i < end; i++)
+          task(i);
+      });
+    }
+
+  }  // namespace tracing
+}  // namespace openvkl
@@ -5,6 +5,7 @@
 #include "../common/Data.h"
 #include "../common/Observer.h"
 #include "../common/export_util.h"
+#include "../common/tracing.h"
 #include "../iterator/Iterator.h"
 #include "../sampler/Sampler.h"
 #include "../value_selector/ValueSelector.h"
@@ -62,6 +63,18 @@ namespace openvkl {
       return (VKLData)data;
     }
 
+    template <int W>
+    VKLData ISPCDriver<W>::newDataConverted(size_t numItems,
+                                            VKLDataType dataType,
+                                            const void *source,
+                                            VKLDataType sourceType,
+                                            size_t sourceByteStride)
+    {
+      Data *data =
+          new Data(numItems, dataType, source, sourceType, sourceByteStride);
+      return (VKLData)data;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Observer ///////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -214,6 +227,17 @@ namespace openvkl {
       valueSelectorObject.setValues(values);
     }
 
+    template <int W>
+    void ISPCDriver<W>::valueSelectorSetOpacities(
+        VKLValueSelector valueSelector,
+        const range1f &valueRange,
+        const utility::ArrayView<const float> &opacities)
+    {
+      auto &valueSelectorObject =
+          referenceFromHandle<ValueSelector<W>>(valueSelector);
+      valueSelectorObject.setOpacities(valueRange, opacities);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Sampler ////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -233,6 +257,9 @@ namespace openvkl {
       const vvec3fn<WIDTH> &objectCoordinates,                                \
       float *samples)                                                         \
   {                                                                           \
+    addStats(referenceFromHandle<Sampler<W>>(sampler).getStats(),             \
+             VKL_STATS_SAMPLES,                                               \
+             countNonZero(valid, WIDTH));                                     \
     computeSampleAnyWidth<WIDTH>(valid, sampler, objectCoordinates, samples); \
   }
 
@@ -250,6 +277,7 @@ namespace openvkl {
                                        float *sample)
     {
       auto &samplerObject = referenceFromHandle<Sampler<W>>(sampler);
+      addStats(samplerObject.getStats(), VKL_STATS_SAMPLES, 1);
       vfloatn<1> sampleW;
       samplerObject.computeSample(objectCoordinates, sampleW);
       *sample = sampleW[0];
@@ -261,7 +289,10 @@ namespace openvkl {
                                        const vvec3fn<1> *objectCoordinates,
                                        float *samples)
     {
+      tracing::Scope scope("vklComputeSampleN");
+
       auto &samplerObject = referenceFromHandle<Sampler<W>>(sampler);
+      addStats(samplerObject.getStats(), VKL_STATS_SAMPLES, N);
       samplerObject.computeSampleN(N, objectCoordinates, samples);
     }
 
@@ -273,6 +304,10 @@ namespace openvkl {
       const vvec3fn<WIDTH> &objectCoordinates,         \
       vvec3fn<WIDTH> &gradients)                       \
   {                                                    \
+    addStats(referenceFromHandle<Sampler<W>>(sampler)  \
+                 .getStats(),                          \
+             VKL_STATS_GRADIENTS,                      \
+             countNonZero(valid, WIDTH));              \
     computeGradientAnyWidth<WIDTH>(                    \
         valid, sampler, objectCoordinates, gradients); \
   }
@@ -290,10 +325,20 @@ namespace openvkl {
                                          const vvec3fn<1> *objectCoordinates,
                                          vvec3fn<1> *gradients)
     {
+      tracing::Scope scope("vklComputeGradientN");
+
       auto &samplerObject = referenceFromHandle<Sampler<W>>(sampler);
+      addStats(samplerObject.getStats(), VKL_STATS_GRADIENTS, N);
       samplerObject.computeGradientN(N, objectCoordinates, gradients);
     }
 
+    template <int W>
+    VKLSamplerFunctions ISPCDriver<W>::getSamplerFunctions(VKLSampler sampler)
+    {
+      auto &samplerObject = referenceFromHandle<Sampler<W>>(sampler);
+      return samplerObject.getFunctions();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Volume /////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -313,7 +358,14 @@ namespace openvkl {
 
       std::stringstream ss;
       ss << type << "_" << W;
-      return (VKLVolume)Volume<W>::createInstance(ss.str());
+
+      Volume<W> *volume = Volume<W>::createInstance(ss.str());
+
+      if (volume) {
+        volume->setMemoryTotals(volumeMemoryTotals);
+      }
+
+      return (VKLVolume)volume;
     }
 
     template <int W>
@@ -330,6 +382,19 @@ namespace openvkl {
       return volumeObject.getValueRange();
     }
 
+    template <int W>
+    VKLMemoryUsage ISPCDriver<W>::getVolumeMemoryUsage(VKLVolume volume)
+    {
+      auto &volumeObject = referenceFromHandle<Volume<W>>(volume);
+      return volumeObject.getMemoryUsage();
+    }
+
+    template <int W>
+    VKLMemoryUsage ISPCDriver<W>::getTotalVolumeMemoryUsage()
+    {
+      return volumeMemoryTotals->getUsage();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Private methods ////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -3,9 +3,15 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
 #include "../../../api/Driver.h"
 #include "../common/align.h"
+#include "../common/tracing.h"
 #include "../iterator/Iterator.h"
+#include "../iterator/RayStream.h"
+#include "../volume/VolumeMemoryTotals.h"
+#include "../volume/VolumeStats.h"
 
 namespace openvkl {
   namespace ispc_driver {
@@ -42,6 +48,12 @@ namespace openvkl {
                       VKLDataCreationFlags dataCreationFlags,
                       size_t byteStride) override;
 
+      VKLData newDataConverted(size_t numItems,
+                               VKLDataType dataType,
+                               const void *source,
+                               VKLDataType sourceType,
+                               size_t sourceByteStride) override;
+
       /////////////////////////////////////////////////////////////////////////
       // Observer /////////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -152,6 +164,37 @@ namespace openvkl {
 
 #undef __define_iterateIntervalN
 
+      void iterateIntervalN(VKLVolume volume,
+                            unsigned int N,
+                            const vvec3fn<1> *origin,
+                            const vvec3fn<1> *direction,
+                            const vrange1fn<1> *tRange,
+                            VKLValueSelector valueSelector,
+                            VKLIntervalStreamFunc callback,
+                            void *userData) const override;
+
+      void setIntervalIteratorTRange1(
+          VKLIntervalIterator iterator,
+          const vrange1fn<1> &tRange) const override;
+
+#define __define_setIntervalIteratorTRangeN(WIDTH)              \
+  void setIntervalIteratorTRange##WIDTH(                        \
+      const int *valid,                                         \
+      VKLIntervalIterator##WIDTH iterator,                      \
+      const vrange1fn<WIDTH> &tRange) const override            \
+  {                                                             \
+    setIntervalIteratorTRangeAnyWidth<WIDTH>(                   \
+        valid,                                                  \
+        referenceFromHandle<IntervalIterator<WIDTH>>(iterator), \
+        tRange);                                                \
+  }
+
+      __define_setIntervalIteratorTRangeN(4);
+      __define_setIntervalIteratorTRangeN(8);
+      __define_setIntervalIteratorTRangeN(16);
+
+#undef __define_setIntervalIteratorTRangeN
+
      private:
       template <int OW>
       EnableIf<(W == OW)> iterateIntervalAnyWidth(
@@ -167,6 +210,18 @@ namespace openvkl {
           vVKLIntervalN<OW> &interval,
           int *result) const;
 
+      template <int OW>
+      EnableIf<(W == OW)> setIntervalIteratorTRangeAnyWidth(
+          const int *valid,
+          IntervalIterator<OW> &iterator,
+          const vrange1fn<OW> &tRange) const;
+
+      template <int OW>
+      EnableIf<(W != OW)> setIntervalIteratorTRangeAnyWidth(
+          const int *valid,
+          IntervalIterator<OW> &iterator,
+          const vrange1fn<OW> &tRange) const;
+
       /////////////////////////////////////////////////////////////////////////
       // Hit iterator /////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -269,6 +324,40 @@ namespace openvkl {
 
 #undef __define_iterateHitN
 
+      unsigned int iterateHits1(VKLHitIterator iterator,
+                                unsigned int maxHits,
+                                vVKLHitN<1> *hits) const override;
+
+      void iterateHitN(VKLVolume volume,
+                       unsigned int N,
+                       const vvec3fn<1> *origin,
+                       const vvec3fn<1> *direction,
+                       const vrange1fn<1> *tRange,
+                       VKLValueSelector valueSelector,
+                       VKLHitStreamFunc callback,
+                       void *userData) const override;
+
+      void setHitIteratorTRange1(VKLHitIterator iterator,
+                                 const vrange1fn<1> &tRange) const override;
+
+#define __define_setHitIteratorTRangeN(WIDTH)              \
+  void setHitIteratorTRange##WIDTH(                        \
+      const int *valid,                                    \
+      VKLHitIterator##WIDTH iterator,                      \
+      const vrange1fn<WIDTH> &tRange) const override       \
+  {                                                        \
+    setHitIteratorTRangeAnyWidth<WIDTH>(                   \
+        valid,                                             \
+        referenceFromHandle<HitIterator<WIDTH>>(iterator), \
+        tRange);                                           \
+  }
+
+      __define_setHitIteratorTRangeN(4);
+      __define_setHitIteratorTRangeN(8);
+      __define_setHitIteratorTRangeN(16);
+
+#undef __define_setHitIteratorTRangeN
+
      private:
       template <int OW>
       EnableIf<(W == OW)> iterateHitAnyWidth(const int *valid,
@@ -282,6 +371,18 @@ namespace openvkl {
                                              vVKLHitN<OW> &interval,
                                              int *result) const;
 
+      template <int OW>
+      EnableIf<(W == OW)> setHitIteratorTRangeAnyWidth(
+          const int *valid,
+          HitIterator<OW> &iterator,
+          const vrange1fn<OW> &tRange) const;
+
+      template <int OW>
+      EnableIf<(W != OW)> setHitIteratorTRangeAnyWidth(
+          const int *valid,
+          HitIterator<OW> &iterator,
+          const vrange1fn<OW> &tRange) const;
+
       /////////////////////////////////////////////////////////////////////////
       // Module ///////////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -323,6 +424,11 @@ namespace openvkl {
           VKLValueSelector valueSelector,
           const utility::ArrayView<const float> &values) override;
 
+      void valueSelectorSetOpacities(
+          VKLValueSelector valueSelector,
+          const range1f &valueRange,
+          const utility::ArrayView<const float> &opacities) override;
+
       /////////////////////////////////////////////////////////////////////////
       // Sampler //////////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -365,6 +471,8 @@ namespace openvkl {
                             const vvec3fn<1> *objectCoordinates,
                             vvec3fn<1> *gradients) override;
 
+      VKLSamplerFunctions getSamplerFunctions(VKLSampler sampler) override;
+
       /////////////////////////////////////////////////////////////////////////
       // Volume ///////////////////////////////////////////////////////////////
       /////////////////////////////////////////////////////////////////////////
@@ -375,6 +483,10 @@ namespace openvkl {
 
       range1f getValueRange(VKLVolume volume) override;
 
+      VKLMemoryUsage getVolumeMemoryUsage(VKLVolume volume) override;
+
+      VKLMemoryUsage getTotalVolumeMemoryUsage() override;
+
      private:
       template <int OW>
       typename std::enable_if<(OW < W), void>::type computeSampleAnyWidth(
@@ -417,6 +529,10 @@ namespace openvkl {
           VKLSampler sampler,
           const vvec3fn<OW> &objectCoordinates,
           vvec3fn<OW> &gradients);
+
+      // shared with all volumes created by this driver
+      std::shared_ptr<VolumeMemoryTotals> volumeMemoryTotals{
+          std::make_shared<VolumeMemoryTotals>()};
     };
 
     ////////////////////////////////////////////////////////////////////////////
@@ -494,6 +610,42 @@ namespace openvkl {
 
     ////////////////////////////////////////////////////////////////////////////
 
+    template <int W>
+    inline void ISPCDriver<W>::setIntervalIteratorTRange1(
+        VKLIntervalIterator iterator, const vrange1fn<1> &tRange) const
+    {
+      auto &it = referenceFromHandle<IntervalIterator<W>>(iterator);
+      it.setTRangeU(tRange);
+    }
+
+    template <int W>
+    template <int OW>
+    inline EnableIf<(W == OW)> ISPCDriver<W>::setIntervalIteratorTRangeAnyWidth(
+        const int *valid,
+        IntervalIterator<OW> &iterator,
+        const vrange1fn<OW> &tRange) const
+    {
+      vintn<W> validW;
+      for (int i = 0; i < W; i++)
+        validW[i] = valid[i];
+
+      iterator.setTRangeV(validW, tRange);
+    }
+
+    template <int W>
+    template <int OW>
+    inline EnableIf<(W != OW)> ISPCDriver<W>::setIntervalIteratorTRangeAnyWidth(
+        const int *valid,
+        IntervalIterator<OW> &iterator,
+        const vrange1fn<OW> &tRange) const
+    {
+      throw std::runtime_error(
+          "interval iterators are only supported for the "
+          "native vector width");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+
     template <int W>
     inline void ISPCDriver<W>::iterateInterval1(
         const VKLIntervalIterator iterator,
@@ -503,6 +655,9 @@ namespace openvkl {
       auto &it = referenceFromHandle<IntervalIterator<W>>(iterator);
       it.iterateIntervalU(*reinterpret_cast<vVKLIntervalN<1> *>(&interval),
                           reinterpret_cast<vintn<1> &>(*result));
+
+      addStats(
+          it.getVolume()->getStats(), VKL_STATS_INTERVALS, *result != 0);
     }
 
     template <int W>
@@ -522,8 +677,16 @@ namespace openvkl {
       iterator.iterateIntervalV(
           validW, *reinterpret_cast<vVKLIntervalN<W> *>(&interval), resultW);
 
-      for (int i = 0; i < W; i++)
+      uint64_t numIntervals = 0;
+
+      for (int i = 0; i < W; i++) {
         result[i] = resultW[i];
+        numIntervals += (validW[i] && resultW[i]);
+      }
+
+      addStats(iterator.getVolume()->getStats(),
+               VKL_STATS_INTERVALS,
+               numIntervals);
     }
 
     template <int W>
@@ -539,6 +702,99 @@ namespace openvkl {
           "native vector width");
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+
+    template <int W>
+    inline void ISPCDriver<W>::iterateIntervalN(
+        VKLVolume volume,
+        unsigned int N,
+        const vvec3fn<1> *origin,
+        const vvec3fn<1> *direction,
+        const vrange1fn<1> *tRange,
+        VKLValueSelector valueSelector,
+        VKLIntervalStreamFunc callback,
+        void *userData) const
+    {
+      tracing::Scope scope("vklIterateIntervalN");
+
+      auto &vol           = referenceFromHandle<Volume<W>>(volume);
+      const auto &factory = vol.getIntervalIteratorFactory();
+
+      std::vector<char> buffer(factory.sizeV());
+
+      RayStream<W> stream(N, origin, direction, tRange);
+
+      vintn<W> validW;
+      unsigned int rayIndex[W];
+      vvec3fn<W> originW;
+      vvec3fn<W> directionW;
+      vrange1fn<W> tRangeW;
+
+      vVKLIntervalN<W> intervalW;
+      vintn<W> resultW;
+
+      uint64_t numIntervals = 0;
+
+      while (stream.nextPacket(
+          validW, rayIndex, originW, directionW, tRangeW)) {
+        IntervalIterator<W> *it = factory.constructV(&vol, buffer.data());
+        it->initializeIntervalV(
+            validW,
+            originW,
+            directionW,
+            tRangeW,
+            reinterpret_cast<const ValueSelector<W> *>(valueSelector));
+
+        while (true) {
+          it->iterateIntervalV(validW, intervalW, resultW);
+
+          int numActive = 0;
+
+          for (int i = 0; i < W; i++) {
+            if (!validW[i])
+              continue;
+
+            if (!resultW[i]) {
+              validW[i] = 0;
+              continue;
+            }
+
+            // a regrouped ray continues where its last interval ended
+            tRangeW.lower[i] = intervalW.tRange.upper[i];
+
+            if (intervalW.tRange.lower[i] < intervalW.tRange.upper[i]) {
+              VKLInterval interval;
+              interval.tRange.lower     = intervalW.tRange.lower[i];
+              interval.tRange.upper     = intervalW.tRange.upper[i];
+              interval.valueRange.lower = intervalW.valueRange.lower[i];
+              interval.valueRange.upper = intervalW.valueRange.upper[i];
+              interval.nominalDeltaT    = intervalW.nominalDeltaT[i];
+              interval.majorant         = intervalW.majorant[i];
+
+              numIntervals++;
+
+              if (!callback(userData, rayIndex[i], &interval)) {
+                validW[i] = 0;
+                continue;
+              }
+            }
+
+            numActive++;
+          }
+
+          if (numActive == 0)
+            break;
+
+          if (stream.shouldRegroup(numActive)) {
+            stream.requeue(validW, rayIndex, tRangeW);
+            break;
+          }
+        }
+      }
+
+      addStats(vol.getStats(), VKL_STATS_INTERVALS, numIntervals);
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     // Hit iterators
     ////////////////////////////////////////////////////////////////////////////
@@ -613,6 +869,42 @@ namespace openvkl {
 
     ////////////////////////////////////////////////////////////////////////////
 
+    template <int W>
+    inline void ISPCDriver<W>::setHitIteratorTRange1(
+        VKLHitIterator iterator, const vrange1fn<1> &tRange) const
+    {
+      auto &it = referenceFromHandle<HitIterator<W>>(iterator);
+      it.setTRangeU(tRange);
+    }
+
+    template <int W>
+    template <int OW>
+    inline EnableIf<(W == OW)> ISPCDriver<W>::setHitIteratorTRangeAnyWidth(
+        const int *valid,
+        HitIterator<OW> &iterator,
+        const vrange1fn<OW> &tRange) const
+    {
+      vintn<W> validW;
+      for (int i = 0; i < W; i++)
+        validW[i] = valid[i];
+
+      iterator.setTRangeV(validW, tRange);
+    }
+
+    template <int W>
+    template <int OW>
+    inline EnableIf<(W != OW)> ISPCDriver<W>::setHitIteratorTRangeAnyWidth(
+        const int *valid,
+        HitIterator<OW> &iterator,
+        const vrange1fn<OW> &tRange) const
+    {
+      throw std::runtime_error(
+          "hit iterators are only supported for the "
+          "native vector width");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+
     template <int W>
     inline void ISPCDriver<W>::iterateHit1(const VKLHitIterator iterator,
                                            vVKLHitN<1> &hit,
@@ -621,6 +913,106 @@ namespace openvkl {
       auto &it = referenceFromHandle<HitIterator<W>>(iterator);
       it.iterateHitU(*reinterpret_cast<vVKLHitN<1> *>(&hit),
                      reinterpret_cast<vintn<1> &>(*result));
+
+      addStats(it.getVolume()->getStats(), VKL_STATS_HITS, *result != 0);
+    }
+
+    template <int W>
+    inline unsigned int ISPCDriver<W>::iterateHits1(VKLHitIterator iterator,
+                                                    unsigned int maxHits,
+                                                    vVKLHitN<1> *hits) const
+    {
+      auto &it = referenceFromHandle<HitIterator<W>>(iterator);
+
+      const unsigned int numHits = it.iterateHitsU(maxHits, hits);
+      addStats(it.getVolume()->getStats(), VKL_STATS_HITS, numHits);
+
+      return numHits;
+    }
+
+    template <int W>
+    inline void ISPCDriver<W>::iterateHitN(VKLVolume volume,
+                                           unsigned int N,
+                                           const vvec3fn<1> *origin,
+                                           const vvec3fn<1> *direction,
+                                           const vrange1fn<1> *tRange,
+                                           VKLValueSelector valueSelector,
+                                           VKLHitStreamFunc callback,
+                                           void *userData) const
+    {
+      tracing::Scope scope("vklIterateHitN");
+
+      auto &vol           = referenceFromHandle<Volume<W>>(volume);
+      const auto &factory = vol.getHitIteratorFactory();
+
+      std::vector<char> buffer(factory.sizeV());
+
+      RayStream<W> stream(N, origin, direction, tRange);
+
+      vintn<W> validW;
+      unsigned int rayIndex[W];
+      vvec3fn<W> originW;
+      vvec3fn<W> directionW;
+      vrange1fn<W> tRangeW;
+
+      vVKLHitN<W> hitW;
+      vintn<W> resultW;
+
+      uint64_t numHits = 0;
+
+      while (stream.nextPacket(
+          validW, rayIndex, originW, directionW, tRangeW)) {
+        HitIterator<W> *it = factory.constructV(&vol, buffer.data());
+        it->initializeHitV(
+            validW,
+            originW,
+            directionW,
+            tRangeW,
+            reinterpret_cast<const ValueSelector<W> *>(valueSelector));
+
+        while (true) {
+          it->iterateHitV(validW, hitW, resultW);
+
+          int numActive = 0;
+
+          for (int i = 0; i < W; i++) {
+            if (!validW[i])
+              continue;
+
+            if (!resultW[i]) {
+              validW[i] = 0;
+              continue;
+            }
+
+            numHits++;
+
+            // a regrouped ray continues just past its last hit
+            tRangeW.lower[i] = hitW.t[i] + hitW.epsilon[i];
+
+            VKLHit hit;
+            hit.t       = hitW.t[i];
+            hit.sample  = hitW.sample[i];
+            hit.epsilon = hitW.epsilon[i];
+
+            if (!callback(userData, rayIndex[i], &hit)) {
+              validW[i] = 0;
+              continue;
+            }
+
+            numActive++;
+          }
+
+          if (numActive == 0)
+            break;
+
+          if (stream.shouldRegroup(numActive)) {
+            stream.requeue(validW, rayIndex, tRangeW);
+            break;
+          }
+        }
+      }
+
+      addStats(vol.getStats(), VKL_STATS_HITS, numHits);
     }
 
     template <int W>
@@ -640,8 +1032,14 @@ namespace openvkl {
       iterator.iterateHitV(
           validW, *reinterpret_cast<vVKLHitN<W> *>(&hit), resultW);
 
-      for (int i = 0; i < W; i++)
+      uint64_t numHits = 0;
+
+      for (int i = 0; i < W; i++) {
         result[i] = resultW[i];
+        numHits += (validW[i] && resultW[i]);
+      }
+
+      addStats(iterator.getVolume()->getStats(), VKL_STATS_HITS, numHits);
     }
 
     template <int W>
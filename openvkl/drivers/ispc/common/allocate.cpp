@@ -0,0 +1,25 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../common/allocation.h"
+#include "export_util.h"
+#include <new>
+
+// called from ISPC code; see allocate.ih. Exceptions must not propagate into
+// ISPC code, so failed allocations return null like ISPC's new.
+extern "C" void *EXPORT_UNIQUE(Allocation_allocate,
+                               uint64_t numBytes,
+                               int category)
+{
+  try {
+    return openvkl::allocation::allocate(
+        numBytes, static_cast<VKLAllocationCategory>(category));
+  } catch (const std::bad_alloc &) {
+    return nullptr;
+  }
+}
+
+extern "C" void EXPORT_UNIQUE(Allocation_deallocate, void *ptr)
+{
+  openvkl::allocation::deallocate(ptr);
+}
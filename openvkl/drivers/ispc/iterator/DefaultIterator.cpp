@@ -47,6 +47,54 @@ namespace openvkl {
                 static_cast<int *>(result));
     }
 
+    template <int W>
+    void DefaultIntervalIterator<W>::initializeIntervalU(
+        const vvec3fn<1> &origin,
+        const vvec3fn<1> &direction,
+        const vrange1fn<1> &tRange,
+        const ValueSelector<W> *valueSelector)
+    {
+      box3f boundingBox  = volume->getBoundingBox();
+      range1f valueRange = volume->getValueRange();
+
+      CALL_ISPC(DefaultIntervalIteratorU_Initialize,
+                ispcStorage,
+                volume->getISPCEquivalent(),
+                (void *)&origin,
+                (void *)&direction,
+                (void *)&tRange,
+                valueSelector ? valueSelector->getISPCEquivalent() : nullptr,
+                (const ispc::box3f &)boundingBox,
+                (const ispc::box1f &)valueRange);
+    }
+
+    template <int W>
+    void DefaultIntervalIterator<W>::iterateIntervalU(
+        vVKLIntervalN<1> &interval, vintn<1> &result)
+    {
+      CALL_ISPC(DefaultIntervalIteratorU_iterateInterval,
+                ispcStorage,
+                &interval,
+                static_cast<int *>(result));
+    }
+
+    template <int W>
+    void DefaultIntervalIterator<W>::setTRangeV(const vintn<W> &valid,
+                                                const vrange1fn<W> &tRange)
+    {
+      CALL_ISPC(DefaultIntervalIterator_setTRange,
+                static_cast<const int *>(valid),
+                ispcStorage,
+                (void *)&tRange);
+    }
+
+    template <int W>
+    void DefaultIntervalIterator<W>::setTRangeU(const vrange1fn<1> &tRange)
+    {
+      CALL_ISPC(
+          DefaultIntervalIteratorU_setTRange, ispcStorage, (void *)&tRange);
+    }
+
     template class DefaultIntervalIterator<VKL_TARGET_WIDTH>;
 
   }  // namespace ispc_driver
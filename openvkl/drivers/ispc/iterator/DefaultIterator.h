@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include "../common/export_util.h"
 #include "DefaultIterator_ispc.h"
 #include "Iterator.h"
@@ -26,6 +27,20 @@ namespace openvkl {
                             vVKLIntervalN<W> &interval,
                             vintn<W> &result) override final;
 
+      void setTRangeV(const vintn<W> &valid,
+                      const vrange1fn<W> &tRange) override final;
+
+      void initializeIntervalU(
+          const vvec3fn<1> &origin,
+          const vvec3fn<1> &direction,
+          const vrange1fn<1> &tRange,
+          const ValueSelector<W> *valueSelector) override final;
+
+      void iterateIntervalU(vVKLIntervalN<1> &interval,
+                            vintn<1> &result) override final;
+
+      void setTRangeU(const vrange1fn<1> &tRange) override final;
+
       void *getIspcStorage() override final
       {
         return reinterpret_cast<void *>(ispcStorage);
@@ -54,6 +69,12 @@ namespace openvkl {
                        vVKLHitN<W> &hit,
                        vintn<W> &result) override final;
 
+      void setTRangeV(const vintn<W> &valid,
+                      const vrange1fn<W> &tRange) override final;
+
+      unsigned int iterateHitsU(unsigned int maxHits,
+                                vVKLHitN<1> *hits) override final;
+
      protected:
       IntervalIterator intervalIterator;
 
@@ -108,5 +129,62 @@ namespace openvkl {
                 &hit,
                 static_cast<int *>(result));
     }
+
+    template <int W, class IntervalIterator>
+    void DefaultHitIterator<W, IntervalIterator>::setTRangeV(
+        const vintn<W> &valid, const vrange1fn<W> &tRange)
+    {
+      intervalIterator.setTRangeV(valid, tRange);
+
+      CALL_ISPC(DefaultHitIterator_setTRange,
+                static_cast<const int *>(valid),
+                ispcStorage,
+                (void *)&tRange);
+    }
+
+    template <int W, class IntervalIterator>
+    unsigned int DefaultHitIterator<W, IntervalIterator>::iterateHitsU(
+        unsigned int maxHits, vVKLHitN<1> *hits)
+    {
+      vintn<W> validW;
+      for (int i = 0; i < W; i++)
+        validW[i] = i == 0 ? -1 : 0;
+
+      // hits are found in batches of varying hits, of which we only use the
+      // first lane
+      constexpr unsigned int batchSize = 16;
+      vVKLHitN<W> hitsW[batchSize];
+
+      unsigned int numHits = 0;
+
+      while (numHits < maxHits) {
+        const unsigned int numRequested =
+            std::min(batchSize, maxHits - numHits);
+
+        vintn<W> numFoundW;
+
+        CALL_ISPC(DefaultHitIterator_iterateHits,
+                  static_cast<const int *>(validW),
+                  ispcStorage,
+                  numRequested,
+                  hitsW,
+                  static_cast<int *>(numFoundW));
+
+        const unsigned int numFound = numFoundW[0];
+
+        for (unsigned int i = 0; i < numFound; i++) {
+          hits[numHits + i].t[0]       = hitsW[i].t[0];
+          hits[numHits + i].sample[0]  = hitsW[i].sample[0];
+          hits[numHits + i].epsilon[0] = hitsW[i].epsilon[0];
+        }
+
+        numHits += numFound;
+
+        if (numFound < numRequested)
+          break;
+      }
+
+      return numHits;
+    }
   }  // namespace ispc_driver
 }  // namespace openvkl
@@ -69,6 +69,24 @@ namespace openvkl {
                 static_cast<int *>(result));
     }
 
+    template <int W>
+    void GridAcceleratorIntervalIterator<W>::setTRangeV(
+        const vintn<W> &valid, const vrange1fn<W> &tRange)
+    {
+      CALL_ISPC(GridAcceleratorIteratorV_setTRange,
+                static_cast<const int *>(valid),
+                ispcStorage,
+                (void *)&tRange);
+    }
+
+    template <int W>
+    void GridAcceleratorIntervalIterator<W>::setTRangeU(
+        const vrange1fn<1> &tRange)
+    {
+      CALL_ISPC(
+          GridAcceleratorIteratorU_setTRange, ispcStorage, (void *)&tRange);
+    }
+
     template class GridAcceleratorIntervalIterator<VKL_TARGET_WIDTH>;
 
     ////////////////////////////////////////////////////////////////////////////
@@ -132,6 +150,36 @@ namespace openvkl {
                 static_cast<int *>(result));
     }
 
+    template <int W>
+    unsigned int GridAcceleratorHitIterator<W>::iterateHitsU(
+        unsigned int maxHits, vVKLHitN<1> *hits)
+    {
+      unsigned int numHits = 0;
+      CALL_ISPC(GridAcceleratorIteratorU_iterateHits,
+                ispcStorage,
+                maxHits,
+                hits,
+                &numHits);
+      return numHits;
+    }
+
+    template <int W>
+    void GridAcceleratorHitIterator<W>::setTRangeV(const vintn<W> &valid,
+                                                   const vrange1fn<W> &tRange)
+    {
+      CALL_ISPC(GridAcceleratorIteratorV_setTRange,
+                static_cast<const int *>(valid),
+                ispcStorage,
+                (void *)&tRange);
+    }
+
+    template <int W>
+    void GridAcceleratorHitIterator<W>::setTRangeU(const vrange1fn<1> &tRange)
+    {
+      CALL_ISPC(
+          GridAcceleratorIteratorU_setTRange, ispcStorage, (void *)&tRange);
+    }
+
     template class GridAcceleratorHitIterator<VKL_TARGET_WIDTH>;
 
   }  // namespace ispc_driver
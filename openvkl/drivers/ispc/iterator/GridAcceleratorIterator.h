@@ -27,6 +27,9 @@ namespace openvkl {
                             vVKLIntervalN<W> &interval,
                             vintn<W> &result) override final;
 
+      void setTRangeV(const vintn<W> &valid,
+                      const vrange1fn<W> &tRange) override final;
+
       // Uniform.
 
       void initializeIntervalU(
@@ -38,6 +41,8 @@ namespace openvkl {
       void iterateIntervalU(vVKLIntervalN<1> &interval,
                             vintn<1> &result) override final;
 
+      void setTRangeU(const vrange1fn<1> &tRange) override final;
+
 
       void *getIspcStorage() override final
       {
@@ -72,6 +77,9 @@ namespace openvkl {
                        vVKLHitN<W> &hit,
                        vintn<W> &result) override final;
 
+      void setTRangeV(const vintn<W> &valid,
+                      const vrange1fn<W> &tRange) override final;
+
       // Uniform.
 
       void initializeHitU(const vvec3fn<1> &origin,
@@ -81,6 +89,11 @@ namespace openvkl {
 
       void iterateHitU(vVKLHitN<1> &hit, vintn<1> &result) override final;
 
+      unsigned int iterateHitsU(unsigned int maxHits,
+                                vVKLHitN<1> *hits) override final;
+
+      void setTRangeU(const vrange1fn<1> &tRange) override final;
+
      protected:
       using Iterator<W>::volume;
       using IspcIterator = __varying_ispc_type(GridAcceleratorIterator);
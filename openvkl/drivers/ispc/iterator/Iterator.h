@@ -42,6 +42,11 @@ namespace openvkl {
       // WORKAROUND ICC 15: This destructor must be public!
       virtual ~Iterator() = default;
 
+      const Volume<W> *getVolume() const
+      {
+        return volume;
+      }
+
      protected:
       const Volume<W> *volume;
     };
@@ -95,10 +100,22 @@ namespace openvkl {
         interval.valueRange.lower[0] = intervalW.valueRange.lower[0];
         interval.valueRange.upper[0] = intervalW.valueRange.upper[0];
         interval.nominalDeltaT[0]    = intervalW.nominalDeltaT[0];
+        interval.majorant[0]         = intervalW.majorant[0];
 
         result[0] = resultW[0];
       }
 
+      virtual void setTRangeU(const vrange1fn<1> &tRange)
+      {
+        vintn<W> validW;
+        for (int i = 0; i < W; i++)
+          validW[i] = i == 0 ? -1 : 0;
+
+        vrange1fn<W> tRangeW = static_cast<vrange1fn<W>>(tRange);
+
+        setTRangeV(validW, tRangeW);
+      }
+
       /*
        * Varying code path.
        */
@@ -113,6 +130,14 @@ namespace openvkl {
                                     vVKLIntervalN<W> &interval,
                                     vintn<W> &result) = 0;
 
+      /*
+       * Restrict the remaining iteration of an initialized iterator to the
+       * intersection of its current t range and the given one. Iterators
+       * should prune their traversal state rather than filter their output.
+       */
+      virtual void setTRangeV(const vintn<W> &valid,
+                              const vrange1fn<W> &tRange) = 0;
+
       /* 
        * This interface is used by the default hit iterator.
        */
@@ -167,6 +192,38 @@ namespace openvkl {
         result[0]      = resultW[0];
       }
 
+      /*
+       * Find up to maxHits hits, in order, and return the number of hits
+       * found. Implementations should keep their traversal state local
+       * between hits; by default, this simply calls iterateHitU() repeatedly.
+       */
+      virtual unsigned int iterateHitsU(unsigned int maxHits,
+                                        vVKLHitN<1> *hits)
+      {
+        unsigned int numHits = 0;
+
+        for (; numHits < maxHits; numHits++) {
+          vintn<1> result;
+          iterateHitU(hits[numHits], result);
+
+          if (!result[0])
+            break;
+        }
+
+        return numHits;
+      }
+
+      virtual void setTRangeU(const vrange1fn<1> &tRange)
+      {
+        vintn<W> validW;
+        for (int i = 0; i < W; i++)
+          validW[i] = i == 0 ? -1 : 0;
+
+        vrange1fn<W> tRangeW = static_cast<vrange1fn<W>>(tRange);
+
+        setTRangeV(validW, tRangeW);
+      }
+
       /*
        * Varying code path.
        */
@@ -180,6 +237,12 @@ namespace openvkl {
       virtual void iterateHitV(const vintn<W> &valid,
                                vVKLHitN<W> &hit,
                                vintn<W> &result) = 0;
+
+      /*
+       * See IntervalIterator::setTRangeV().
+       */
+      virtual void setTRangeV(const vintn<W> &valid,
+                              const vrange1fn<W> &tRange) = 0;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,145 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <deque>
+#include "../common/math.h"
+#include "../common/simd.h"
+#include "openvkl/openvkl.h"
+
+namespace openvkl {
+  namespace ispc_driver {
+
+    /*
+     * Distributes a stream of N rays over packets of width W.
+     *
+     * Packets are filled with rays that were regrouped from earlier packets
+     * first, and then with rays that have not been started yet. A ray is
+     * regrouped by requeueing it with the remaining part of its t range.
+     */
+    template <int W>
+    struct RayStream
+    {
+      RayStream(unsigned int N,
+                const vvec3fn<1> *origin,
+                const vvec3fn<1> *direction,
+                const vrange1fn<1> *tRange);
+
+      /*
+       * Fill the next packet. Returns false if there are no rays left.
+       */
+      bool nextPacket(vintn<W> &valid,
+                      unsigned int *rayIndex,
+                      vvec3fn<W> &originW,
+                      vvec3fn<W> &directionW,
+                      vrange1fn<W> &tRangeW);
+
+      /*
+       * Regrouping restarts rays, which is only worth it while there are
+       * other rays to fill the packet with, and once at least half of the
+       * lanes have become idle.
+       */
+      bool shouldRegroup(int numActive) const
+      {
+        return numActive <= W / 2 &&
+               (!requeued.empty() || nextRay < numRays);
+      }
+
+      /*
+       * Requeue the valid lanes of the given packet. Lanes whose t range
+       * is empty are dropped.
+       */
+      void requeue(const vintn<W> &valid,
+                   const unsigned int *rayIndex,
+                   const vrange1fn<W> &tRangeW);
+
+     private:
+      struct QueuedRay
+      {
+        unsigned int rayIndex;
+        range1f tRange;
+      };
+
+      const unsigned int numRays;
+      const vvec3fn<1> *origin;
+      const vvec3fn<1> *direction;
+      const vrange1fn<1> *tRange;
+
+      unsigned int nextRay{0};
+      std::deque<QueuedRay> requeued;
+    };
+
+    // Inlined definitions ////////////////////////////////////////////////////
+
+    template <int W>
+    inline RayStream<W>::RayStream(unsigned int N,
+                                   const vvec3fn<1> *origin,
+                                   const vvec3fn<1> *direction,
+                                   const vrange1fn<1> *tRange)
+        : numRays(N), origin(origin), direction(direction), tRange(tRange)
+    {
+    }
+
+    template <int W>
+    inline bool RayStream<W>::nextPacket(vintn<W> &valid,
+                                         unsigned int *rayIndex,
+                                         vvec3fn<W> &originW,
+                                         vvec3fn<W> &directionW,
+                                         vrange1fn<W> &tRangeW)
+    {
+      bool any = false;
+
+      for (int i = 0; i < W; i++) {
+        valid[i] = 0;
+
+        unsigned int index;
+        range1f r;
+
+        if (!requeued.empty()) {
+          index = requeued.front().rayIndex;
+          r     = requeued.front().tRange;
+          requeued.pop_front();
+        } else if (nextRay < numRays) {
+          index = nextRay++;
+          r     = range1f(tRange[index].lower[0], tRange[index].upper[0]);
+        } else {
+          // inactive lanes are never read by the iterators
+          originW.x[i] = originW.y[i] = originW.z[i] = 0.f;
+          directionW.x[i] = directionW.y[i] = directionW.z[i] = 0.f;
+          tRangeW.lower[i] = tRangeW.upper[i] = 0.f;
+          continue;
+        }
+
+        valid[i]         = -1;
+        rayIndex[i]      = index;
+        originW.x[i]     = origin[index].x[0];
+        originW.y[i]     = origin[index].y[0];
+        originW.z[i]     = origin[index].z[0];
+        directionW.x[i]  = direction[index].x[0];
+        directionW.y[i]  = direction[index].y[0];
+        directionW.z[i]  = direction[index].z[0];
+        tRangeW.lower[i] = r.lower;
+        tRangeW.upper[i] = r.upper;
+
+        any = true;
+      }
+
+      return any;
+    }
+
+    template <int W>
+    inline void RayStream<W>::requeue(const vintn<W> &valid,
+                                      const unsigned int *rayIndex,
+                                      const vrange1fn<W> &tRangeW)
+    {
+      for (int i = 0; i < W; i++) {
+        if (valid[i] && tRangeW.lower[i] < tRangeW.upper[i]) {
+          requeued.push_back(
+              {rayIndex[i], range1f(tRangeW.lower[i], tRangeW.upper[i])});
+        }
+      }
+    }
+
+  }  // namespace ispc_driver
+}  // namespace openvkl
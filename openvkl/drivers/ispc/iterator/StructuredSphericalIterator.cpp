@@ -0,0 +1,55 @@
+// Copyright 2019-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "StructuredSphericalIterator.h"
+#include "../common/export_util.h"
+#include "../value_selector/ValueSelector.h"
+#include "../volume/Volume.h"
+#include "StructuredSphericalIterator_ispc.h"
+
+namespace openvkl {
+  namespace ispc_driver {
+
+    template <int W>
+    void StructuredSphericalIntervalIterator<W>::initializeIntervalV(
+        const vintn<W> &valid,
+        const vvec3fn<W> &origin,
+        const vvec3fn<W> &direction,
+        const vrange1fn<W> &tRange,
+        const ValueSelector<W> *valueSelector)
+    {
+      CALL_ISPC(StructuredSphericalIterator_Initialize,
+                static_cast<const int *>(valid),
+                ispcStorage,
+                volume->getISPCEquivalent(),
+                (void *)&origin,
+                (void *)&direction,
+                (void *)&tRange,
+                valueSelector ? valueSelector->getISPCEquivalent() : nullptr);
+    }
+
+    template <int W>
+    void StructuredSphericalIntervalIterator<W>::iterateIntervalV(
+        const vintn<W> &valid, vVKLIntervalN<W> &interval, vintn<W> &result)
+    {
+      CALL_ISPC(StructuredSphericalIterator_iterateInterval,
+                static_cast<const int *>(valid),
+                ispcStorage,
+                &interval,
+                static_cast<int *>(result));
+    }
+
+    template <int W>
+    void StructuredSphericalIntervalIterator<W>::setTRangeV(
+        const vintn<W> &valid, const vrange1fn<W> &tRange)
+    {
+      CALL_ISPC(StructuredSphericalIterator_setTRange,
+                static_cast<const int *>(valid),
+                ispcStorage,
+                (void *)&tRange);
+    }
+
+    template class StructuredSphericalIntervalIterator<VKL_TARGET_WIDTH>;
+
+  }  // namespace ispc_driver
+}  // namespace openvkl
@@ -0,0 +1,58 @@
+// Copyright 2019-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "DefaultIterator.h"
+#include "Iterator.h"
+#include "StructuredSphericalIterator_ispc.h"
+
+namespace openvkl {
+  namespace ispc_driver {
+
+    template <int W>
+    struct StructuredSphericalIntervalIterator : public IntervalIterator<W>
+    {
+      using IntervalIterator<W>::IntervalIterator;
+
+      void initializeIntervalV(
+          const vintn<W> &valid,
+          const vvec3fn<W> &origin,
+          const vvec3fn<W> &direction,
+          const vrange1fn<W> &tRange,
+          const ValueSelector<W> *valueSelector) override final;
+
+      void iterateIntervalV(const vintn<W> &valid,
+                            vVKLIntervalN<W> &interval,
+                            vintn<W> &result) override final;
+
+      void setTRangeV(const vintn<W> &valid,
+                      const vrange1fn<W> &tRange) override final;
+
+      void *getIspcStorage() override final
+      {
+        return reinterpret_cast<void *>(ispcStorage);
+      }
+
+     protected:
+      using Iterator<W>::volume;
+      using IspcIterator = __varying_ispc_type(StructuredSphericalIterator);
+      alignas(alignof(IspcIterator)) char ispcStorage[sizeof(IspcIterator)];
+    };
+
+    template <int W>
+    using StructuredSphericalIntervalIteratorFactory =
+        ConcreteIteratorFactory<W,
+                                IntervalIterator,
+                                StructuredSphericalIntervalIterator>;
+
+    template <int W>
+    using StructuredSphericalHitIterator =
+        DefaultHitIterator<W, StructuredSphericalIntervalIterator<W>>;
+
+    template <int W>
+    using StructuredSphericalHitIteratorFactory =
+        ConcreteIteratorFactory<W, HitIterator, StructuredSphericalHitIterator>;
+
+  }  // namespace ispc_driver
+}  // namespace openvkl
@@ -46,6 +46,48 @@ namespace openvkl {
                 static_cast<int *>(result));
     }
 
+    template <int W>
+    void UnstructuredIntervalIterator<W>::initializeIntervalU(
+        const vvec3fn<1> &origin,
+        const vvec3fn<1> &direction,
+        const vrange1fn<1> &tRange,
+        const ValueSelector<W> *valueSelector)
+    {
+      CALL_ISPC(UnstructuredIteratorU_Initialize,
+                ispcStorage,
+                volume->getISPCEquivalent(),
+                (void *)&origin,
+                (void *)&direction,
+                (void *)&tRange,
+                valueSelector ? valueSelector->getISPCEquivalent() : nullptr);
+    }
+
+    template <int W>
+    void UnstructuredIntervalIterator<W>::iterateIntervalU(
+        vVKLIntervalN<1> &interval, vintn<1> &result)
+    {
+      CALL_ISPC(UnstructuredIteratorU_iterateInterval,
+                ispcStorage,
+                &interval,
+                static_cast<int *>(result));
+    }
+
+    template <int W>
+    void UnstructuredIntervalIterator<W>::setTRangeV(const vintn<W> &valid,
+                                                     const vrange1fn<W> &tRange)
+    {
+      CALL_ISPC(UnstructuredIterator_setTRange,
+                static_cast<const int *>(valid),
+                ispcStorage,
+                (void *)&tRange);
+    }
+
+    template <int W>
+    void UnstructuredIntervalIterator<W>::setTRangeU(const vrange1fn<1> &tRange)
+    {
+      CALL_ISPC(UnstructuredIteratorU_setTRange, ispcStorage, (void *)&tRange);
+    }
+
     template class UnstructuredIntervalIterator<VKL_TARGET_WIDTH>;
 
   }  // namespace ispc_driver
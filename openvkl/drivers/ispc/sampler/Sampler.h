@@ -5,6 +5,7 @@
 
 #include "../common/ManagedObject.h"
 #include "../common/simd.h"
+#include "../volume/VolumeStats.h"
 #include "openvkl/openvkl.h"
 #include "rkcommon/math/vec.h"
 
@@ -13,9 +14,14 @@ using namespace rkcommon;
 namespace openvkl {
   namespace ispc_driver {
 
+    template <int W>
+    struct Volume;
+
     template <int W>
     struct Sampler : public ManagedObject
     {
+      explicit Sampler(const Volume<W> &volume);
+
       // samplers can optionally define a scalar sampling method; if not
       // defined then the default implementation will use computeSampleV()
       virtual void computeSample(const vvec3fn<1> &objectCoordinates,
@@ -36,10 +42,35 @@ namespace openvkl {
       virtual void computeGradientN(unsigned int N,
                                     const vvec3fn<1> *objectCoordinates,
                                     vvec3fn<1> *gradients) const = 0;
+
+      // direct scalar entry points, called by applications without going
+      // through the driver; see vklGetSamplerFunctions(). samplers may
+      // override this to bypass the virtual methods above
+      virtual VKLSamplerFunctions getFunctions() const;
+
+      /*
+       * Work counters of the sampled volume, or null if not enabled.
+       */
+      VolumeStats *getStats() const;
+
+     protected:
+      static float computeSampleDirect(VKLSampler sampler,
+                                       const vkl_vec3f *objectCoordinates);
+
+      static vkl_vec3f computeGradientDirect(
+          VKLSampler sampler, const vkl_vec3f *objectCoordinates);
+
+     private:
+      const Volume<W> &samplerVolume;
     };
 
     // Inlined definitions ////////////////////////////////////////////////////
 
+    template <int W>
+    inline Sampler<W>::Sampler(const Volume<W> &volume) : samplerVolume(volume)
+    {
+    }
+
     template <int W>
     inline void Sampler<W>::computeSample(const vvec3fn<1> &objectCoordinates,
                                           vfloatn<1> &samples) const
@@ -62,5 +93,59 @@ namespace openvkl {
       samples[0] = samplesW[0];
     }
 
+    template <int W>
+    inline VKLSamplerFunctions Sampler<W>::getFunctions() const
+    {
+      VKLSamplerFunctions functions;
+      functions.computeSample   = computeSampleDirect;
+      functions.computeGradient = computeGradientDirect;
+      return functions;
+    }
+
+    template <int W>
+    inline VolumeStats *Sampler<W>::getStats() const
+    {
+      return samplerVolume.getStats();
+    }
+
+    template <int W>
+    inline float Sampler<W>::computeSampleDirect(
+        VKLSampler sampler, const vkl_vec3f *objectCoordinates)
+    {
+      const auto &samplerObject = referenceFromHandle<Sampler<W>>(sampler);
+
+      addStats(samplerObject.getStats(), VKL_STATS_SAMPLES, 1);
+
+      vfloatn<1> sample;
+      samplerObject.computeSample(
+          reinterpret_cast<const vvec3fn<1> &>(*objectCoordinates), sample);
+
+      return sample[0];
+    }
+
+    template <int W>
+    inline vkl_vec3f Sampler<W>::computeGradientDirect(
+        VKLSampler sampler, const vkl_vec3f *objectCoordinates)
+    {
+      const auto &samplerObject = referenceFromHandle<Sampler<W>>(sampler);
+
+      addStats(samplerObject.getStats(), VKL_STATS_GRADIENTS, 1);
+
+      vvec3fn<W> ocW = static_cast<vvec3fn<W>>(
+          reinterpret_cast<const vvec3fn<1> &>(*objectCoordinates));
+
+      vintn<W> validW;
+      for (int i = 0; i < W; i++)
+        validW[i] = i == 0 ? 1 : 0;
+
+      ocW.fill_inactive_lanes(validW);
+
+      vvec3fn<W> gradientsW;
+
+      samplerObject.computeGradientV(validW, ocW, gradientsW);
+
+      return vkl_vec3f{gradientsW.x[0], gradientsW.y[0], gradientsW.z[0]};
+    }
+
   }  // namespace ispc_driver
 }  // namespace openvkl
@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "ValueSelector.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <new>
 #include "../common/export_util.h"
 #include "../volume/Volume.h"
 #include "ValueSelector_ispc.h"
@@ -27,14 +31,39 @@ namespace openvkl {
     {
       if (ispcEquivalent) {
         CALL_ISPC(ValueSelector_Destructor, ispcEquivalent);
+        ispcEquivalent = nullptr;
       }
 
-      ispcEquivalent = CALL_ISPC(ValueSelector_Constructor,
-                                 nullptr,
-                                 ranges.size(),
-                                 (const ispc::box1f *)ranges.data(),
-                                 values.size(),
-                                 (const float *)values.data());
+      // explicitly set ranges have no opacity information, so they are
+      // treated as fully opaque
+      std::vector<range1f> allRanges = ranges;
+      std::vector<float> allMaxOpacities(ranges.size(), 1.f);
+
+      computeOpacityRanges(allRanges, allMaxOpacities);
+
+      // the ISPC side relies on ranges being sorted and non-overlapping, and
+      // values being sorted and unique, so that overlap tests can use binary
+      // search
+      std::vector<range1f> mergedRanges;
+      std::vector<float> mergedMaxOpacities;
+      mergeRanges(
+          allRanges, allMaxOpacities, mergedRanges, mergedMaxOpacities);
+
+      std::vector<float> sortedValues = sortValues(values);
+
+      ispcEquivalent = CALL_ISPC(
+          ValueSelector_Constructor,
+          nullptr,
+          mergedRanges.size(),
+          (const ispc::box1f *)mergedRanges.data(),
+          opacities.empty() ? nullptr : mergedMaxOpacities.data(),
+          getParam<float>("majorantScale", 1.f),
+          sortedValues.size(),
+          (const float *)sortedValues.data());
+
+      if (!ispcEquivalent) {
+        throw std::bad_alloc();
+      }
     }
 
     template <int W>
@@ -59,6 +88,123 @@ namespace openvkl {
       }
     }
 
+    template <int W>
+    void ValueSelector<W>::setOpacities(
+        const range1f &valueRange,
+        const utility::ArrayView<const float> &opacities)
+    {
+      this->opacityValueRange = valueRange;
+      this->opacities.clear();
+
+      for (const auto &o : opacities) {
+        this->opacities.push_back(o);
+      }
+    }
+
+    template <int W>
+    void ValueSelector<W>::computeOpacityRanges(
+        std::vector<range1f> &ranges, std::vector<float> &maxOpacities) const
+    {
+      const size_t numOpacities = opacities.size();
+
+      if (numOpacities == 0) {
+        return;
+      }
+
+      auto addRange = [&](float lower, float upper, float maxOpacity) {
+        // this also rejects NaN opacities
+        if (maxOpacity > 0.f) {
+          ranges.push_back(range1f(lower, upper));
+          maxOpacities.push_back(maxOpacity);
+        }
+      };
+
+      const float lower = opacityValueRange.lower;
+      const float upper = opacityValueRange.upper;
+
+      // values outside the transfer function value range are clamped to the
+      // first and last opacities, respectively
+      addRange(neg_inf, lower, opacities.front());
+      addRange(upper, inf, opacities.back());
+
+      if (numOpacities == 1) {
+        addRange(lower, upper, opacities.front());
+        return;
+      }
+
+      // opacities are linearly interpolated between uniformly spaced samples,
+      // so a segment is transparent only if both its end points are
+      const float spacing = (upper - lower) / float(numOpacities - 1);
+
+      for (size_t i = 0; i < numOpacities - 1; i++) {
+        addRange(lower + float(i) * spacing,
+                 lower + float(i + 1) * spacing,
+                 std::max(opacities[i], opacities[i + 1]));
+      }
+    }
+
+    template <int W>
+    void ValueSelector<W>::mergeRanges(const std::vector<range1f> &ranges,
+                                       const std::vector<float> &maxOpacities,
+                                       std::vector<range1f> &mergedRanges,
+                                       std::vector<float> &mergedMaxOpacities)
+    {
+      std::vector<size_t> sorted;
+      sorted.reserve(ranges.size());
+
+      // empty or NaN ranges can never overlap anything
+      for (size_t i = 0; i < ranges.size(); i++) {
+        if (ranges[i].lower <= ranges[i].upper) {
+          sorted.push_back(i);
+        }
+      }
+
+      std::sort(sorted.begin(), sorted.end(), [&](size_t a, size_t b) {
+        return ranges[a].lower < ranges[b].lower;
+      });
+
+      mergedRanges.clear();
+      mergedMaxOpacities.clear();
+
+      // ranges that only touch are merged only if that does not raise the
+      // opacity of either, so that adjacent transfer function segments keep
+      // their own max opacities; bounds stay non-decreasing either way
+      for (const auto &i : sorted) {
+        const range1f &r = ranges[i];
+
+        if (!mergedRanges.empty() &&
+            (r.lower < mergedRanges.back().upper ||
+             (r.lower == mergedRanges.back().upper &&
+              maxOpacities[i] == mergedMaxOpacities.back()))) {
+          mergedRanges.back().upper =
+              std::max(mergedRanges.back().upper, r.upper);
+          mergedMaxOpacities.back() =
+              std::max(mergedMaxOpacities.back(), maxOpacities[i]);
+        } else {
+          mergedRanges.push_back(r);
+          mergedMaxOpacities.push_back(maxOpacities[i]);
+        }
+      }
+    }
+
+    template <int W>
+    std::vector<float> ValueSelector<W>::sortValues(
+        const std::vector<float> &values)
+    {
+      std::vector<float> sorted;
+      sorted.reserve(values.size());
+
+      std::copy_if(values.begin(),
+                   values.end(),
+                   std::back_inserter(sorted),
+                   [](float v) { return !std::isnan(v); });
+
+      std::sort(sorted.begin(), sorted.end());
+      sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+      return sorted;
+    }
+
     template struct ValueSelector<VKL_TARGET_WIDTH>;
 
   }  // namespace ispc_driver
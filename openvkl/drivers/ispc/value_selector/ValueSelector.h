@@ -28,14 +28,32 @@ namespace openvkl {
       void setRanges(const utility::ArrayView<const range1f> &ranges);
       void setValues(const utility::ArrayView<const float> &values);
 
+      // opacities are uniformly spaced samples of a piecewise linear transfer
+      // function over valueRange; the non-transparent value ranges are added
+      // to the explicitly set ranges on commit
+      void setOpacities(const range1f &valueRange,
+                        const utility::ArrayView<const float> &opacities);
+
       void *getISPCEquivalent() const;
 
      private:
+      void computeOpacityRanges(std::vector<range1f> &ranges,
+                                std::vector<float> &maxOpacities) const;
+
+      static void mergeRanges(const std::vector<range1f> &ranges,
+                              const std::vector<float> &maxOpacities,
+                              std::vector<range1f> &mergedRanges,
+                              std::vector<float> &mergedMaxOpacities);
+      static std::vector<float> sortValues(const std::vector<float> &values);
+
       const Volume<W> *volume{nullptr};
 
       std::vector<range1f> ranges;
       std::vector<float> values;
 
+      range1f opacityValueRange{0.f, 1.f};
+      std::vector<float> opacities;
+
       void *ispcEquivalent{nullptr};
     };
 
@@ -3,6 +3,7 @@
 
 #include "StructuredRegularVolume.h"
 #include "../common/export_util.h"
+#include "../common/tracing.h"
 
 namespace openvkl {
   namespace ispc_driver {
@@ -10,6 +11,8 @@ namespace openvkl {
     template <int W>
     void StructuredRegularVolume<W>::commit()
     {
+      tracing::Scope scope("StructuredRegularVolume::commit");
+
       StructuredVolume<W>::commit();
 
       if (!this->ispcEquivalent) {
@@ -37,6 +40,10 @@ namespace openvkl {
         throw std::runtime_error("failed to commit StructuredRegularVolume");
       }
 
+      CALL_ISPC(SharedStructuredVolume_setAnalyticHits,
+                this->ispcEquivalent,
+                this->template getParam<bool>("analyticHits", false));
+
       // must be last
       this->buildAccelerator();
     }
@@ -40,8 +40,14 @@ namespace openvkl {
                             const vvec3fn<1> *objectCoordinates,
                             vvec3fn<1> *gradients) const override final;
 
+      VKLSamplerFunctions getFunctions() const override final;
+
      protected:
       const StructuredVolume<W> *volume{nullptr};
+
+     private:
+      static float computeSampleStructured(VKLSampler sampler,
+                                           const vkl_vec3f *objectCoordinates);
     };
 
     // Inlined definitions ////////////////////////////////////////////////////
@@ -49,7 +55,7 @@ namespace openvkl {
     template <int W>
     inline StructuredSampler<W>::StructuredSampler(
         const StructuredVolume<W> *volume)
-        : volume(volume)
+        : Sampler<W>(*volume), volume(volume)
     {
       assert(volume);
     }
@@ -116,5 +122,31 @@ namespace openvkl {
                 (ispc::vec3f *)gradients);
     }
 
+    template <int W>
+    inline VKLSamplerFunctions StructuredSampler<W>::getFunctions() const
+    {
+      VKLSamplerFunctions functions = Sampler<W>::getFunctions();
+      functions.computeSample       = computeSampleStructured;
+      return functions;
+    }
+
+    template <int W>
+    inline float StructuredSampler<W>::computeSampleStructured(
+        VKLSampler sampler, const vkl_vec3f *objectCoordinates)
+    {
+      // no virtual dispatch: call straight into the ISPC sampling function
+      const auto &samplerObject =
+          referenceFromHandle<StructuredSampler<W>>(sampler);
+
+      addStats(samplerObject.getStats(), VKL_STATS_SAMPLES, 1);
+
+      float sample;
+      CALL_ISPC(SharedStructuredVolume_sample_uniform_export,
+                samplerObject.volume->getISPCEquivalent(),
+                objectCoordinates,
+                &sample);
+      return sample;
+    }
+
   }  // namespace ispc_driver
 }  // namespace openvkl
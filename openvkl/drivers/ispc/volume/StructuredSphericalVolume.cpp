@@ -3,6 +3,7 @@
 
 #include "StructuredSphericalVolume.h"
 #include "../common/export_util.h"
+#include "../common/tracing.h"
 
 namespace openvkl {
   namespace ispc_driver {
@@ -10,6 +11,8 @@ namespace openvkl {
     template <int W>
     void StructuredSphericalVolume<W>::commit()
     {
+      tracing::Scope scope("StructuredSphericalVolume::commit");
+
       StructuredVolume<W>::commit();
 
       if (!this->ispcEquivalent) {
@@ -88,6 +91,10 @@ namespace openvkl {
         throw std::runtime_error("failed to commit StructuredSphericalVolume");
       }
 
+      CALL_ISPC(SharedStructuredVolume_setApproximateSphericalTransform,
+                this->ispcEquivalent,
+                this->template getParam<bool>("approximateTransform", false));
+
       // must be last
       this->buildAccelerator();
     }
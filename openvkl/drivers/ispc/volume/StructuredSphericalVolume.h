@@ -4,24 +4,11 @@
 #pragma once
 
 #include "StructuredVolume.h"
-#include "../iterator/DefaultIterator.h"
+#include "../iterator/StructuredSphericalIterator.h"
 
 namespace openvkl {
   namespace ispc_driver {
 
-    template <int W>
-    using StructuredSphericalIntervalIteratorFactory =
-        ConcreteIteratorFactory<W,
-                                IntervalIterator,
-                                DefaultIntervalIterator>;
-
-    template <int W>
-    using StructuredSphericalHitIterator = DefaultHitIterator<W, DefaultIntervalIterator<W>>;
-
-    template <int W>
-    using StructuredSphericalHitIteratorFactory =
-        ConcreteIteratorFactory<W, HitIterator, StructuredSphericalHitIterator>;
-
     template <int W>
     struct StructuredSphericalVolume : public StructuredVolume<W>
     {
@@ -41,10 +28,9 @@ namespace openvkl {
         return hitIteratorFactory;
       }
 
-      // note, although we construct the GridAccelerator for all structured
-      // volumes (including this one), we only use it here for computing
-      // value range. we don't yet use it for iterators since the nextCell()
-      // implementation is only correct for structured regular volumes.
+      // iterators traverse the GridAccelerator macrocells in (r, inclination,
+      // azimuth) space; GridAccelerator_nextCell() is only correct for
+      // structured regular volumes.
 
       StructuredSphericalIntervalIteratorFactory<W> intervalIteratorFactory;
       StructuredSphericalHitIteratorFactory<W> hitIteratorFactory;
@@ -6,6 +6,7 @@
 #include "../common/Data.h"
 #include "../common/export_util.h"
 #include "../common/math.h"
+#include "../common/tracing.h"
 #include "GridAccelerator_ispc.h"
 #include "SharedStructuredVolume_ispc.h"
 #include "Volume.h"
@@ -37,6 +38,7 @@ namespace openvkl {
       vec3f gridOrigin;
       vec3f gridSpacing;
       Ref<const Data> voxelData;
+      bool adaptiveNominalDeltaT;
     };
 
     // Inlined definitions ////////////////////////////////////////////////////
@@ -58,6 +60,9 @@ namespace openvkl {
 
       voxelData = this->template getParam<Data *>("data");
 
+      adaptiveNominalDeltaT =
+          this->template getParam<bool>("adaptiveNominalDeltaT", false);
+
       if (voxelData->size() != this->dimensions.long_product()) {
         throw std::runtime_error(
             "incorrect data size for provided volume dimensions");
@@ -94,8 +99,15 @@ namespace openvkl {
     template <int W>
     inline void StructuredVolume<W>::buildAccelerator()
     {
+      tracing::Scope scope("buildAccelerator");
+
       void *accelerator = CALL_ISPC(SharedStructuredVolume_createAccelerator,
-                                    this->ispcEquivalent);
+                                    this->ispcEquivalent,
+                                    adaptiveNominalDeltaT);
+
+      if (!accelerator) {
+        throw std::bad_alloc();
+      }
 
       vec3i bricksPerDimension;
       bricksPerDimension.x =
@@ -107,14 +119,21 @@ namespace openvkl {
 
       const int numTasks =
           bricksPerDimension.x * bricksPerDimension.y * bricksPerDimension.z;
-      tasking::parallel_for(numTasks, [&](int taskIndex) {
+      tracing::parallel_for("buildBrick", numTasks, [&](int taskIndex) {
         CALL_ISPC(GridAccelerator_build, accelerator, taskIndex);
       });
 
+      CALL_ISPC(GridAccelerator_computeDeltaTScales, accelerator);
+
       CALL_ISPC(GridAccelerator_computeValueRange,
                 accelerator,
                 valueRange.lower,
                 valueRange.upper);
+
+      this->setMemoryUsage(
+          this->ownedBytes(voxelData),
+          CALL_ISPC(GridAccelerator_getMemoryUsage, accelerator),
+          0);
     }
 
   }  // namespace ispc_driver
@@ -46,7 +46,7 @@ namespace openvkl {
     template <int W>
     inline UnstructuredSampler<W>::UnstructuredSampler(
         const UnstructuredVolume<W> *volume)
-        : volume(volume)
+        : Sampler<W>(*volume), volume(volume)
     {
       assert(volume);
     }
@@ -3,6 +3,8 @@
 
 #include "UnstructuredVolume.h"
 #include "../common/Data.h"
+#include "../common/allocation.h"
+#include "../common/tracing.h"
 #include "UnstructuredSampler.h"
 #include "rkcommon/containers/AlignedVector.h"
 #include "rkcommon/tasking/parallel_for.h"
@@ -74,6 +76,8 @@ namespace openvkl {
     template <int W>
     void UnstructuredVolume<W>::commit()
     {
+      tracing::Scope scope("UnstructuredVolume::commit");
+
       Volume<W>::commit();
 
       // hex method planar/nonplanar
@@ -198,6 +202,10 @@ namespace openvkl {
 
       if (!this->ispcEquivalent) {
         this->ispcEquivalent = CALL_ISPC(VKLUnstructuredVolume_Constructor);
+
+        if (!this->ispcEquivalent) {
+          throw std::bad_alloc();
+        }
       }
 
       CALL_ISPC(
@@ -218,6 +226,23 @@ namespace openvkl {
                               : (const ispc::vec3f *)faceNormals.data(),
           iterativeTolerance.empty() ? nullptr : iterativeTolerance.data(),
           hexIterative);
+
+      size_t dataBytes = this->ownedBytes(vertexPosition) +
+                         this->ownedBytes(vertexValue) +
+                         this->ownedBytes(cellValue) +
+                         this->ownedBytes(cellType);
+
+      dataBytes += index32Bit ? this->ownedBytes(index32)
+                              : this->ownedBytes(index64);
+      dataBytes += cell32Bit ? this->ownedBytes(cellIndex32)
+                             : this->ownedBytes(cellIndex64);
+
+      this->setMemoryUsage(
+          dataBytes,
+          bvhMemoryUsage(rtcRoot),
+          generatedCellType.capacity() * sizeof(uint8_t) +
+              faceNormals.capacity() * sizeof(vec3f) +
+              iterativeTolerance.capacity() * sizeof(float));
     }
 
     template <int W>
@@ -265,18 +290,24 @@ namespace openvkl {
     template <int W>
     void UnstructuredVolume<W>::buildBvhAndCalculateBounds()
     {
-      rtcDevice = rtcNewDevice(NULL);
+      // Embree allocates the BVH itself; forward the huge page policy
+      rtcDevice = rtcNewDevice(allocation::hugePages() ==
+                                       allocation::HugePages::None
+                                   ? NULL
+                                   : "hugepages=1");
       if (!rtcDevice) {
         throw std::runtime_error("cannot create device");
       }
       rtcSetDeviceErrorFunction(rtcDevice, errorFunction, NULL);
 
+      tracing::Scope phase("computeCellBounds");
+
       containers::AlignedVector<RTCBuildPrimitive> prims;
       containers::AlignedVector<range1f> range;
       prims.resize(nCells);
       range.resize(nCells);
 
-      tasking::parallel_for(nCells, [&](uint64_t taskIndex) {
+      tracing::parallel_for("getCellBBox", nCells, [&](uint64_t taskIndex) {
         box4f bound              = getCellBBox(taskIndex);
         prims[taskIndex].lower_x = bound.lower.x;
         prims[taskIndex].lower_y = bound.lower.y;
@@ -289,6 +320,8 @@ namespace openvkl {
         range[taskIndex]         = range1f(bound.lower.w, bound.upper.w);
       });
 
+      phase.next("buildBvh");
+
       rtcBVH = rtcNewBVH(rtcDevice);
       if (!rtcBVH) {
         throw std::runtime_error("bvh creation failure");
@@ -336,6 +369,8 @@ namespace openvkl {
     template <int W>
     void UnstructuredVolume<W>::calculateIterativeTolerance()
     {
+      tracing::Scope scope("calculateIterativeTolerance");
+
       iterativeTolerance.resize(nCells);
       const uint32_t wedgeEdges[9][2]   = {{0, 1},
                                          {1, 2},
@@ -351,22 +386,23 @@ namespace openvkl {
       const uint32_t hexDiagonals[4][2] = {{0, 6}, {1, 7}, {2, 4}, {3, 5}};
 
       // Build all tolerances
-      tasking::parallel_for(nCells, [&](uint64_t taskIndex) {
-        switch ((*cellType)[taskIndex]) {
-        case VKL_HEXAHEDRON:
-          if (!hexIterative)
-            calculateTolerance(taskIndex, hexDiagonals, 4);
-          break;
-        case VKL_WEDGE:
-          calculateTolerance(taskIndex, wedgeEdges, 9);
-          break;
-        case VKL_PYRAMID:
-          calculateTolerance(taskIndex, pyramidEdges, 8);
-          break;
-        default:
-          break;
-        }
-      });
+      tracing::parallel_for(
+          "calculateTolerance", nCells, [&](uint64_t taskIndex) {
+            switch ((*cellType)[taskIndex]) {
+            case VKL_HEXAHEDRON:
+              if (!hexIterative)
+                calculateTolerance(taskIndex, hexDiagonals, 4);
+              break;
+            case VKL_WEDGE:
+              calculateTolerance(taskIndex, wedgeEdges, 9);
+              break;
+            case VKL_PYRAMID:
+              calculateTolerance(taskIndex, pyramidEdges, 8);
+              break;
+            default:
+              break;
+            }
+          });
     }
 
     template <int W>
@@ -396,6 +432,8 @@ namespace openvkl {
     template <int W>
     void UnstructuredVolume<W>::calculateFaceNormals()
     {
+      tracing::Scope scope("calculateFaceNormals");
+
       // Allocate memory for normal vectors
       uint64_t numNormals = nCells * 6;
       faceNormals.resize(numNormals);
@@ -411,22 +449,23 @@ namespace openvkl {
           {3, 0, 1}, {4, 1, 0}, {4, 2, 1}, {4, 3, 2}, {3, 4, 0}};
 
       // Build all normals
-      tasking::parallel_for(nCells, [&](uint64_t taskIndex) {
-        switch ((*cellType)[taskIndex]) {
-        case VKL_TETRAHEDRON:
-          calculateCellNormals(taskIndex, tetrahedronFaces, 4);
-          break;
-        case VKL_HEXAHEDRON:
-          calculateCellNormals(taskIndex, hexahedronFaces, 6);
-          break;
-        case VKL_WEDGE:
-          calculateCellNormals(taskIndex, wedgeFaces, 5);
-          break;
-        case VKL_PYRAMID:
-          calculateCellNormals(taskIndex, pyramidFaces, 5);
-          break;
-        }
-      });
+      tracing::parallel_for(
+          "calculateCellNormals", nCells, [&](uint64_t taskIndex) {
+            switch ((*cellType)[taskIndex]) {
+            case VKL_TETRAHEDRON:
+              calculateCellNormals(taskIndex, tetrahedronFaces, 4);
+              break;
+            case VKL_HEXAHEDRON:
+              calculateCellNormals(taskIndex, hexahedronFaces, 6);
+              break;
+            case VKL_WEDGE:
+              calculateCellNormals(taskIndex, wedgeFaces, 5);
+              break;
+            case VKL_PYRAMID:
+              calculateCellNormals(taskIndex, pyramidFaces, 5);
+              break;
+            }
+          });
     }
 
     // Calculate all normals for arbitrary polyhedron
@@ -97,6 +97,22 @@ namespace openvkl {
       }
     };
 
+    /*
+     * Bytes used by the BVH nodes below (and including) the given node.
+     */
+    inline size_t bvhMemoryUsage(const Node *node)
+    {
+      if (!node)
+        return 0;
+
+      if (node->nominalLength < 0)
+        return sizeof(LeafNode);
+
+      auto inner = (const InnerNode *)node;
+      return sizeof(InnerNode) + bvhMemoryUsage(inner->children[0]) +
+             bvhMemoryUsage(inner->children[1]);
+    }
+
     template <int W>
     struct UnstructuredVolume : public Volume<W>
     {
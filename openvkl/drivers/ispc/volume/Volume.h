@@ -3,12 +3,17 @@
 
 #pragma once
 
+#include <memory>
+#include "../common/Data.h"
 #include "../common/ManagedObject.h"
 #include "../common/export_util.h"
 #include "../common/objectFactory.h"
 #include "../iterator/Iterator.h"
 #include "../sampler/Sampler.h"
 #include "../value_selector/ValueSelector.h"
+#include "VolumeMemoryTotals.h"
+#include "VolumeStats.h"
+#include "VolumeStatsObserver.h"
 #include "Volume_ispc.h"
 #include "openvkl/openvkl.h"
 #include "rkcommon/math/box.h"
@@ -25,8 +30,8 @@ namespace openvkl {
     template <int W>
     struct Volume : public ManagedObject
     {
-      Volume()                   = default;
-      virtual ~Volume() override = default;
+      Volume() = default;
+      virtual ~Volume() override;
 
       static Volume *createInstance(const std::string &type);
 
@@ -49,17 +54,67 @@ namespace openvkl {
 
       void *getISPCEquivalent() const;
 
-      virtual VKLObserver newObserver(const char *type)
-      {
-        return nullptr;
-      }
+      virtual VKLObserver newObserver(const char *type);
+
+      /*
+       * Work counters of this volume, or null while no "Stats" observer
+       * exists.
+       */
+      VolumeStats *getStats() const;
+
+      /*
+       * Memory used by this volume, as last reported by setMemoryUsage().
+       */
+      VKLMemoryUsage getMemoryUsage() const;
+
+      /*
+       * Add this volume's memory usage to the given totals, which are
+       * normally those of the driver that created it. Must be called before
+       * the volume reports any memory usage.
+       */
+      void setMemoryTotals(std::shared_ptr<VolumeMemoryTotals> totals);
 
      protected:
+      /*
+       * Volume implementations report their memory usage at the end of
+       * commit(), and whenever it changes afterwards.
+       */
+      void setMemoryUsage(size_t data, size_t accelerator, size_t auxiliary);
+
+      /*
+       * Bytes of application data copied into the given Data object, including
+       * nested Data arrays. Shared buffers are not counted.
+       */
+      static size_t ownedBytes(const Data *data);
+
+      /*
+       * Pass the stats pointer on to the ISPC side. Volumes that keep copies
+       * of it (e.g. in acceleration structures) must override this.
+       */
+      virtual void setStats(VolumeStats *stats);
+
       void *ispcEquivalent{nullptr};
+
+     private:
+      std::shared_ptr<VolumeMemoryTotals> memoryTotals;
+
+      VKLMemoryUsage memoryUsage{0, 0, 0, 0};
+
+      // kept after the last observer is released, so that counters persist
+      // and concurrent work never sees a dangling pointer
+      std::unique_ptr<VolumeStats> stats;
+      VolumeStats *activeStats{nullptr};
+      int numStatsObservers{0};
     };
 
     // Inlined definitions ////////////////////////////////////////////////////
 
+    template <int W>
+    inline Volume<W>::~Volume()
+    {
+      setMemoryUsage(0, 0, 0);
+    }
+
     template <int W>
     inline Volume<W> *Volume<W>::createInstance(const std::string &type)
     {
@@ -78,6 +133,96 @@ namespace openvkl {
       return ispcEquivalent;
     }
 
+    template <int W>
+    inline VKLObserver Volume<W>::newObserver(const char *type)
+    {
+      if (std::string(type) == "Stats") {
+        if (!ispcEquivalent)
+          throw std::runtime_error(
+              "Trying to create an observer on a volume that was not "
+              "committed.");
+
+        if (!stats)
+          stats.reset(new VolumeStats());
+
+        if (numStatsObservers++ == 0) {
+          activeStats = stats.get();
+          setStats(activeStats);
+        }
+
+        return (VKLObserver) new VolumeStatsObserver(*this, *stats, [this]() {
+          if (--numStatsObservers == 0) {
+            activeStats = nullptr;
+            setStats(nullptr);
+          }
+        });
+      }
+
+      return nullptr;
+    }
+
+    template <int W>
+    inline VolumeStats *Volume<W>::getStats() const
+    {
+      return activeStats;
+    }
+
+    template <int W>
+    inline void Volume<W>::setStats(VolumeStats *stats)
+    {
+      CALL_ISPC(Volume_setStats, ispcEquivalent, stats);
+    }
+
+    template <int W>
+    inline VKLMemoryUsage Volume<W>::getMemoryUsage() const
+    {
+      return memoryUsage;
+    }
+
+    template <int W>
+    inline void Volume<W>::setMemoryTotals(
+        std::shared_ptr<VolumeMemoryTotals> totals)
+    {
+      memoryTotals = std::move(totals);
+    }
+
+    template <int W>
+    inline void Volume<W>::setMemoryUsage(size_t data,
+                                          size_t accelerator,
+                                          size_t auxiliary)
+    {
+      if (memoryTotals) {
+        // unsigned wrap-around makes these correct for shrinking usage as well
+        memoryTotals->data += data - memoryUsage.data;
+        memoryTotals->accelerator += accelerator - memoryUsage.accelerator;
+        memoryTotals->auxiliary += auxiliary - memoryUsage.auxiliary;
+      }
+
+      memoryUsage.data        = data;
+      memoryUsage.accelerator = accelerator;
+      memoryUsage.auxiliary   = auxiliary;
+      memoryUsage.total       = data + accelerator + auxiliary;
+    }
+
+    template <int W>
+    inline size_t Volume<W>::ownedBytes(const Data *data)
+    {
+      if (!data)
+        return 0;
+
+      size_t bytes = 0;
+
+      if (data->dataCreationFlags != VKL_DATA_SHARED_BUFFER)
+        bytes += data->size() * sizeOf(data->dataType);
+
+      if (data->dataType == VKL_DATA) {
+        for (const Data *d : data->as<Data *>())
+          bytes += ownedBytes(d);
+      }
+
+      return bytes;
+    }
+
 #define VKL_REGISTER_VOLUME(InternalClass, external_name) \
   VKL_REGISTER_OBJECT(                                    \
       ::openvkl::ManagedObject, volume, InternalClass, external_name)
@@ -0,0 +1,37 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include "openvkl/openvkl.h"
+
+namespace openvkl {
+  namespace ispc_driver {
+
+    /*
+     * Combined memory usage of all volumes created by one driver.
+     *
+     * The driver and each of its volumes share ownership, so volumes may
+     * outlive the driver that created them.
+     */
+    struct VolumeMemoryTotals
+    {
+      std::atomic<size_t> data{0};
+      std::atomic<size_t> accelerator{0};
+      std::atomic<size_t> auxiliary{0};
+
+      VKLMemoryUsage getUsage() const
+      {
+        VKLMemoryUsage usage;
+        usage.data        = data;
+        usage.accelerator = accelerator;
+        usage.auxiliary   = auxiliary;
+        usage.total       = usage.data + usage.accelerator + usage.auxiliary;
+        return usage;
+      }
+    };
+
+  }  // namespace ispc_driver
+}  // namespace openvkl
@@ -0,0 +1,65 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "VolumeStats.h"
+#include "../common/allocation.h"
+#include "../common/export_util.h"
+
+namespace openvkl {
+  namespace ispc_driver {
+
+    VolumeStats::VolumeStats()
+    {
+      for (Slot &slot : slots) {
+        for (auto &counter : slot.counters)
+          counter.store(0, std::memory_order_relaxed);
+      }
+    }
+
+    void VolumeStats::add(VKLStatsCounter counter, uint64_t count)
+    {
+      slots[threadSlot()].counters[counter].fetch_add(
+          count, std::memory_order_relaxed);
+    }
+
+    void VolumeStats::sum(uint64_t *counters) const
+    {
+      for (int c = 0; c < VKL_STATS_NUM_COUNTERS; c++) {
+        counters[c] = 0;
+        for (const Slot &slot : slots)
+          counters[c] += slot.counters[c].load(std::memory_order_relaxed);
+      }
+    }
+
+    void *VolumeStats::operator new(size_t size)
+    {
+      static_assert(alignof(Slot) <= 64, "allocation is 64 byte aligned");
+      return allocation::allocate(size, VKL_ALLOCATION_AUXILIARY);
+    }
+
+    void VolumeStats::operator delete(void *ptr)
+    {
+      allocation::deallocate(ptr);
+    }
+
+    int VolumeStats::threadSlot()
+    {
+      static std::atomic<int> nextSlot{0};
+      thread_local int slot = nextSlot.fetch_add(1) % numSlots;
+      return slot;
+    }
+
+  }  // namespace ispc_driver
+}  // namespace openvkl
+
+// called from ISPC code; see VolumeStats.ih
+extern "C" void EXPORT_UNIQUE(VolumeStats_add,
+                              void *stats,
+                              int counter,
+                              int64_t count)
+{
+  using namespace openvkl::ispc_driver;
+  addStats(static_cast<VolumeStats *>(stats),
+           static_cast<VKLStatsCounter>(counter),
+           static_cast<uint64_t>(count));
+}
@@ -0,0 +1,72 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "openvkl/openvkl.h"
+
+namespace openvkl {
+  namespace ispc_driver {
+
+    /*
+     * Counters behind the "Stats" volume observer.
+     *
+     * Counts are kept in a fixed number of slots, each on its own cache line.
+     * Every thread adds to the slot it is assigned on first use, so threads
+     * only share a slot if there are more threads than slots.
+     */
+    struct VolumeStats
+    {
+      VolumeStats();
+
+      void add(VKLStatsCounter counter, uint64_t count);
+
+      /*
+       * Write the sum over all slots to counters[0 .. VKL_STATS_NUM_COUNTERS).
+       */
+      void sum(uint64_t *counters) const;
+
+      // slots must be cache line aligned
+      static void *operator new(size_t size);
+      static void operator delete(void *ptr);
+
+     private:
+      static constexpr int numSlots = 64;
+
+      struct alignas(64) Slot
+      {
+        std::atomic<uint64_t> counters[VKL_STATS_NUM_COUNTERS];
+      };
+
+      static int threadSlot();
+
+      Slot slots[numSlots];
+    };
+
+    /*
+     * Add to a counter, if stats are being collected.
+     */
+    inline void addStats(VolumeStats *stats,
+                         VKLStatsCounter counter,
+                         uint64_t count)
+    {
+      if (stats && count)
+        stats->add(counter, count);
+    }
+
+    /*
+     * The number of nonzero values, e.g. valid lanes or iterator results.
+     */
+    inline uint64_t countNonZero(const int *values, int numValues)
+    {
+      uint64_t count = 0;
+      for (int i = 0; i < numValues; i++)
+        count += (values[i] != 0);
+      return count;
+    }
+
+  }  // namespace ispc_driver
+}  // namespace openvkl
@@ -0,0 +1,44 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "VolumeStatsObserver.h"
+
+namespace openvkl {
+  namespace ispc_driver {
+
+    VolumeStatsObserver::VolumeStatsObserver(ManagedObject &target,
+                                             const VolumeStats &stats,
+                                             std::function<void()> release)
+        : target(&target), stats(&stats), release(std::move(release))
+    {
+      this->target->refInc();
+    }
+
+    VolumeStatsObserver::~VolumeStatsObserver()
+    {
+      if (release)
+        release();
+
+      target->refDec();
+    }
+
+    const void *VolumeStatsObserver::map()
+    {
+      stats->sum(counters);
+      return counters;
+    }
+
+    void VolumeStatsObserver::unmap() {}
+
+    size_t VolumeStatsObserver::getNumElements() const
+    {
+      return VKL_STATS_NUM_COUNTERS;
+    }
+
+    VKLDataType VolumeStatsObserver::getElementType() const
+    {
+      return VKL_ULONG;
+    }
+
+  }  // namespace ispc_driver
+}  // namespace openvkl
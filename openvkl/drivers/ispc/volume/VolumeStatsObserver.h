@@ -0,0 +1,45 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include "../common/Observer.h"
+#include "VolumeStats.h"
+
+namespace openvkl {
+  namespace ispc_driver {
+
+    /*
+     * The stats observer returns a snapshot of the volume's counters, taken
+     * when it is mapped. See VKLStatsCounter for the layout. The release
+     * function is called on destruction, so that the volume can stop counting
+     * when its last observer is gone.
+     */
+    struct VolumeStatsObserver : public Observer
+    {
+      VolumeStatsObserver(ManagedObject &target,
+                          const VolumeStats &stats,
+                          std::function<void()> release);
+
+      VolumeStatsObserver(VolumeStatsObserver &&) = delete;
+      VolumeStatsObserver &operator=(VolumeStatsObserver &&) = delete;
+      VolumeStatsObserver(const VolumeStatsObserver &)       = delete;
+      VolumeStatsObserver &operator=(const VolumeStatsObserver &) = delete;
+
+      ~VolumeStatsObserver();
+
+      const void *map() override;
+      void unmap() override;
+      VKLDataType getElementType() const override;
+      size_t getNumElements() const override;
+
+     private:
+      ManagedObject *target{nullptr};
+      const VolumeStats *stats{nullptr};
+      std::function<void()> release;
+      uint64_t counters[VKL_STATS_NUM_COUNTERS];
+    };
+
+  }  // namespace ispc_driver
+}  // namespace openvkl
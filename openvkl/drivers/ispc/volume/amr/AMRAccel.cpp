@@ -42,6 +42,21 @@ namespace openvkl {
         node.clear();
       }
 
+      size_t AMRAccel::memoryUsage() const
+      {
+        size_t bytes = level.capacity() * sizeof(Level) +
+                       node.capacity() * sizeof(Node) +
+                       leaf.capacity() * sizeof(Leaf);
+
+        // brick lists are null-terminated
+        for (const auto &n : node) {
+          if (n.isLeaf())
+            bytes += (n.numItems + 1) * sizeof(const AMRData::Brick *);
+        }
+
+        return bytes;
+      }
+
       void AMRAccel::makeLeaf(index_t nodeID,
                               const box3f &bounds,
                               const std::vector<const AMRData::Brick *> &brick)
@@ -90,6 +90,9 @@ namespace openvkl {
           return level.back();
         }
 
+        /*! bytes allocated for levels, nodes, leaves and leaf brick lists */
+        size_t memoryUsage() const;
+
         //! list of levels
         std::vector<Level> level;
         //! list of inner nodes
@@ -0,0 +1,55 @@
+// Copyright 2019-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "../../iterator/DefaultIterator.h"
+#include "../../iterator/Iterator.h"
+#include "AMRIterator_ispc.h"
+
+namespace openvkl {
+  namespace ispc_driver {
+
+    template <int W>
+    struct AMRIntervalIterator : public IntervalIterator<W>
+    {
+      using IntervalIterator<W>::IntervalIterator;
+
+      void initializeIntervalV(
+          const vintn<W> &valid,
+          const vvec3fn<W> &origin,
+          const vvec3fn<W> &direction,
+          const vrange1fn<W> &tRange,
+          const ValueSelector<W> *valueSelector) override final;
+
+      void iterateIntervalV(const vintn<W> &valid,
+                            vVKLIntervalN<W> &interval,
+                            vintn<W> &result) override final;
+
+      void setTRangeV(const vintn<W> &valid,
+                      const vrange1fn<W> &tRange) override final;
+
+      void *getIspcStorage() override final
+      {
+        return reinterpret_cast<void *>(ispcStorage);
+      }
+
+     protected:
+      using Iterator<W>::volume;
+      using IspcIterator = __varying_ispc_type(AMRIterator);
+      alignas(alignof(IspcIterator)) char ispcStorage[sizeof(IspcIterator)];
+    };
+
+    template <int W>
+    using AMRIntervalIteratorFactory =
+        ConcreteIteratorFactory<W, IntervalIterator, AMRIntervalIterator>;
+
+    template <int W>
+    using AMRHitIterator = DefaultHitIterator<W, AMRIntervalIterator<W>>;
+
+    template <int W>
+    using AMRHitIteratorFactory =
+        ConcreteIteratorFactory<W, HitIterator, AMRHitIterator>;
+
+  }  // namespace ispc_driver
+}  // namespace openvkl
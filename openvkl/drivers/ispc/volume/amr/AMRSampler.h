@@ -45,7 +45,7 @@ namespace openvkl {
 
     template <int W>
     inline AMRSampler<W>::AMRSampler(const AMRVolume<W> *volume)
-        : volume(volume)
+        : Sampler<W>(*volume), volume(volume)
     {
       assert(volume);
     }
@@ -4,6 +4,7 @@
 #include "AMRVolume.h"
 #include "../../common/export_util.h"
 #include "../common/Data.h"
+#include "../common/tracing.h"
 #include "AMRSampler.h"
 // rkcommon
 #include "rkcommon/tasking/parallel_for.h"
@@ -24,6 +25,10 @@ namespace openvkl {
     AMRVolume<W>::AMRVolume()
     {
       this->ispcEquivalent = CALL_ISPC(AMRVolume_create, this);
+
+      if (!this->ispcEquivalent) {
+        throw std::bad_alloc();
+      }
     }
 
     template <int W>
@@ -43,6 +48,8 @@ namespace openvkl {
     template <int W>
     void AMRVolume<W>::commit()
     {
+      tracing::Scope scope("AMRVolume::commit");
+
       amrMethod =
           (VKLAMRMethod)this->template getParam<int>("method", VKL_AMR_CURRENT);
 
@@ -79,6 +86,8 @@ namespace openvkl {
             "VKL_FLOAT");
       }
 
+      tracing::Scope phase("AMRData");
+
       // create the AMR data structure. This creates the logical blocks, which
       // contain the actual data and block-level metadata, such as cell width
       // and refinement level
@@ -87,6 +96,8 @@ namespace openvkl {
                                        *cellWidthsData,
                                        *blockDataData);
 
+      phase.next("AMRAccel");
+
       // create the AMR acceleration structure. This creates a k-d tree
       // representation of the blocks in the AMRData object. In short, blocks at
       // the highest refinement level (i.e. with the most detail) are leaf
@@ -123,17 +134,74 @@ namespace openvkl {
                 voxelType,
                 (ispc::box3f &)bounds);
 
+      phase.next("computeLeafValueRanges");
+
       // parse the k-d tree to compute the voxel range of each leaf node.
       // This enables empty space skipping within the hierarchical structure
-      tasking::parallel_for(accel->leaf.size(), [&](size_t leafID) {
-        CALL_ISPC(
-            AMRVolume_computeValueRangeOfLeaf, this->ispcEquivalent, leafID);
-      });
+      tracing::parallel_for(
+          "leafValueRange", accel->leaf.size(), [&](size_t leafID) {
+            computeValueRangeOfLeaf(leafID, coarsestCellWidth);
+          });
 
       // compute value range over the full volume
       for (const auto &l : accel->leaf) {
         valueRange.extend(l.valueRange);
       }
+
+      this->setMemoryUsage(
+          this->ownedBytes(blockDataData) + this->ownedBytes(blockBoundsData) +
+              this->ownedBytes(refinementLevelsData) +
+              this->ownedBytes(cellWidthsData),
+          accel->memoryUsage(),
+          data->brick.capacity() * sizeof(amr::AMRData::Brick));
+    }
+
+    template <int W>
+    void AMRVolume<W>::computeValueRangeOfLeaf(size_t leafID,
+                                               float haloWidth)
+    {
+      amr::AMRAccel::Leaf &leaf = accel->leaf[leafID];
+
+      // every method interpolates between voxels of cells that lie at most
+      // one cell width away from the sample position, possibly in bricks of
+      // neighboring leaves; taking the min / max over all voxels of cells
+      // touching the closed leaf bounds grown by the coarsest cell width
+      // thus bounds any sample within the leaf
+      const box3f haloBounds(leaf.bounds.lower - haloWidth,
+                             leaf.bounds.upper + haloWidth);
+
+      leaf.valueRange = range1f(empty);
+
+      for (size_t b = 0; b < data->brick.size(); b++) {
+        const amr::AMRData::Brick &brick = data->brick[b];
+
+        if (intersectionOf(brick.worldBounds, haloBounds).empty()) {
+          continue;
+        }
+
+        // brick relative indices of the first and last cells touching the
+        // halo bounds
+        const vec3i lower =
+            max(vec3i(floor(haloBounds.lower / brick.cellWidth)) -
+                    brick.box.lower,
+                vec3i(0));
+        const vec3i upper =
+            min(vec3i(floor(haloBounds.upper / brick.cellWidth)) -
+                    brick.box.lower,
+                brick.dims - 1);
+
+        const DataT<float> &voxels = (*blockDataData)[b]->as<float>();
+
+        for (int iz = lower.z; iz <= upper.z; iz++) {
+          for (int iy = lower.y; iy <= upper.y; iy++) {
+            for (int ix = lower.x; ix <= upper.x; ix++) {
+              leaf.valueRange.extend(
+                  voxels[ix + size_t(brick.dims.x) *
+                                  (iy + size_t(brick.dims.y) * iz)]);
+            }
+          }
+        }
+      }
     }
 
     template <int W>
@@ -142,6 +210,12 @@ namespace openvkl {
       return new AMRSampler<W>(this);
     }
 
+    template <int W>
+    void AMRVolume<W>::setStats(VolumeStats *stats)
+    {
+      CALL_ISPC(AMRVolume_setStats, this->ispcEquivalent, stats);
+    }
+
     template <int W>
     box3f AMRVolume<W>::getBoundingBox() const
     {
@@ -4,9 +4,8 @@
 #pragma once
 
 #include "../Volume.h"
-#include "../../iterator/Iterator.h"
-#include "../../iterator/DefaultIterator.h"
 #include "AMRAccel.h"
+#include "AMRIterator.h"
 #include "rkcommon/memory/RefCount.h"
 
 using namespace rkcommon::memory;
@@ -14,20 +13,6 @@ using namespace rkcommon::memory;
 namespace openvkl {
   namespace ispc_driver {
 
-    template <int W>
-    using AmrIntervalIteratorFactory =
-        ConcreteIteratorFactory<W,
-                                IntervalIterator,
-                                DefaultIntervalIterator>;
-
-    template <int W>
-    using AmrHitIterator = DefaultHitIterator<W, DefaultIntervalIterator<W>>;
-
-    template <int W>
-    using AmrHitIteratorFactory =
-        ConcreteIteratorFactory<W, HitIterator, AmrHitIterator>;
-
-
     template <int W>
     struct AMRVolume : public Volume<W>
     {
@@ -68,9 +53,14 @@ namespace openvkl {
         return hitIteratorFactory;
       }
 
+     protected:
+      void setStats(VolumeStats *stats) override;
+
      private:
-      AmrIntervalIteratorFactory<W> intervalIteratorFactory;
-      AmrHitIteratorFactory<W> hitIteratorFactory;
+      void computeValueRangeOfLeaf(size_t leafID, float haloWidth);
+
+      AMRIntervalIteratorFactory<W> intervalIteratorFactory;
+      AMRHitIteratorFactory<W> hitIteratorFactory;
     };
 
   }  // namespace ispc_driver
@@ -45,7 +45,7 @@ namespace openvkl {
 
     template <int W>
     inline ParticleSampler<W>::ParticleSampler(const ParticleVolume<W> *volume)
-        : volume(volume)
+        : Sampler<W>(*volume), volume(volume)
     {
       assert(volume);
     }
@@ -3,6 +3,8 @@
 
 #include "ParticleVolume.h"
 #include "../common/Data.h"
+#include "../common/allocation.h"
+#include "../common/tracing.h"
 #include "ParticleSampler.h"
 #include "rkcommon/containers/AlignedVector.h"
 #include "rkcommon/tasking/parallel_for.h"
@@ -37,6 +39,8 @@ namespace openvkl {
     template <int W>
     void ParticleVolume<W>::commit()
     {
+      tracing::Scope scope("ParticleVolume::commit");
+
       Volume<W>::commit();
 
       positions = this->template getParamDataT<vec3f>("particle.position");
@@ -96,6 +100,10 @@ namespace openvkl {
 
       if (!this->ispcEquivalent) {
         this->ispcEquivalent = CALL_ISPC(VKLParticleVolume_Constructor);
+
+        if (!this->ispcEquivalent) {
+          throw std::bad_alloc();
+        }
       }
 
       CALL_ISPC(VKLParticleVolume_set,
@@ -109,6 +117,12 @@ namespace openvkl {
                 (void *)(rtcRoot));
 
       computeValueRanges();
+
+      this->setMemoryUsage(this->ownedBytes(positions) +
+                               this->ownedBytes(radii) +
+                               this->ownedBytes(weights),
+                           bvhMemoryUsage(rtcRoot),
+                           0);
     }
 
     template <int W>
@@ -120,12 +134,18 @@ namespace openvkl {
     template <int W>
     void ParticleVolume<W>::buildBvhAndCalculateBounds()
     {
-      rtcDevice = rtcNewDevice(NULL);
+      // Embree allocates the BVH itself; forward the huge page policy
+      rtcDevice = rtcNewDevice(allocation::hugePages() ==
+                                       allocation::HugePages::None
+                                   ? NULL
+                                   : "hugepages=1");
       if (!rtcDevice) {
         throw std::runtime_error("cannot create device");
       }
       rtcSetDeviceErrorFunction(rtcDevice, errorFunction, NULL);
 
+      tracing::Scope phase("computeParticleBounds");
+
       containers::AlignedVector<RTCBuildPrimitive> prims;
       containers::AlignedVector<float> primRadii;
 
@@ -134,7 +154,7 @@ namespace openvkl {
       prims.resize(numParticles);
       primRadii.resize(numParticles);
 
-      tasking::parallel_for(numParticles, [&](size_t taskIndex) {
+      tracing::parallel_for("particleBox", numParticles, [&](size_t taskIndex) {
         const vec3f &position = (*positions)[taskIndex];
         const float &radius   = (*radii)[taskIndex];
 
@@ -154,6 +174,8 @@ namespace openvkl {
         primRadii[taskIndex] = radius;
       });
 
+      phase.next("buildBvh");
+
       rtcBVH = rtcNewBVH(rtcDevice);
       if (!rtcBVH) {
         throw std::runtime_error("bvh creation failure");
@@ -200,6 +222,8 @@ namespace openvkl {
     template <int W>
     void ParticleVolume<W>::computeValueRanges()
     {
+      tracing::Scope scope("computeValueRanges");
+
       // this method computes an _estimate_ of value range; this fractional
       // uncertainty will be used to conservatively expand the computed ranges
       // This value also shows up in tests/particle_volume_interval_iterator.cpp
@@ -220,52 +244,57 @@ namespace openvkl {
       std::unique_ptr<Sampler<W>> sampler(newSampler());
 
       if (estimateValueRanges) {
-        tasking::parallel_for(leafNodes.size(), [&](size_t leafNodeIndex) {
-          LeafNode *leafNode         = leafNodes[leafNodeIndex];
-          const size_t particleIndex = leafNode->cellID;
+        tracing::parallel_for(
+            "estimateValueRange",
+            leafNodes.size(),
+            [&](size_t leafNodeIndex) {
+              LeafNode *leafNode         = leafNodes[leafNodeIndex];
+              const size_t particleIndex = leafNode->cellID;
 
-          range1f computedValueRange(empty);
+              range1f computedValueRange(empty);
 
-          // estimates use sampling interfaces directly, to ensure all
-          // constraints are consistently considered (e.g.
-          // clampMaxCumulativeValue, radiusSupportFactor)
+              // estimates use sampling interfaces directly, to ensure all
+              // constraints are consistently considered (e.g.
+              // clampMaxCumulativeValue, radiusSupportFactor)
 
-          // initial estimate based sampling particle center
-          vfloatn<1> sample;
-          sampler->computeSample((*positions)[particleIndex], sample);
-          computedValueRange.extend(sample[0]);
+              // initial estimate based sampling particle center
+              vfloatn<1> sample;
+              sampler->computeSample((*positions)[particleIndex], sample);
+              computedValueRange.extend(sample[0]);
 
-          // sample over regular grid within leaf bounds to improve estimate
-          const box3fa leafBounds = leafNode->bounds;
+              // sample over regular grid within leaf bounds to improve estimate
+              const box3fa leafBounds = leafNode->bounds;
 
-          const int samplesPerDimension = 10;
+              const int samplesPerDimension = 10;
 
-          std::vector<vvec3fn<1>> objectCoordinates;
-          objectCoordinates.reserve(samplesPerDimension * samplesPerDimension *
-                                    samplesPerDimension);
+              std::vector<vvec3fn<1>> objectCoordinates;
+              objectCoordinates.reserve(samplesPerDimension *
+                                        samplesPerDimension *
+                                        samplesPerDimension);
 
-          multidim_index_sequence<3> mis{vec3i(samplesPerDimension)};
+              multidim_index_sequence<3> mis{vec3i(samplesPerDimension)};
 
-          for (const auto &ijk : mis) {
-            objectCoordinates.push_back(
-                leafBounds.lower + vec3f(ijk) / float(samplesPerDimension - 1) *
-                                       leafBounds.size());
-          }
+              for (const auto &ijk : mis) {
+                objectCoordinates.push_back(
+                    leafBounds.lower +
+                    vec3f(ijk) / float(samplesPerDimension - 1) *
+                        leafBounds.size());
+              }
 
-          std::vector<float> samples(objectCoordinates.size());
-          sampler->computeSampleN(objectCoordinates.size(),
-                                  objectCoordinates.data(),
-                                  samples.data());
+              std::vector<float> samples(objectCoordinates.size());
+              sampler->computeSampleN(objectCoordinates.size(),
+                                      objectCoordinates.data(),
+                                      samples.data());
 
-          auto minmax = std::minmax_element(samples.begin(), samples.end());
-          computedValueRange.extend(range1f(*minmax.first, *minmax.second));
+              auto minmax = std::minmax_element(samples.begin(), samples.end());
+              computedValueRange.extend(range1f(*minmax.first, *minmax.second));
 
-          // apply uncertainty to computed value range
-          computedValueRange.lower *= (1.f - uncertainty);
-          computedValueRange.upper *= (1.f + uncertainty);
+              // apply uncertainty to computed value range
+              computedValueRange.lower *= (1.f - uncertainty);
+              computedValueRange.upper *= (1.f + uncertainty);
 
-          leafNode->valueRange = computedValueRange;
-        });
+              leafNode->valueRange = computedValueRange;
+            });
       } else {
         tasking::parallel_for(leafNodes.size(), [&](size_t leafNodeIndex) {
           LeafNode *leafNode   = leafNodes[leafNodeIndex];
@@ -48,7 +48,6 @@ struct VdbGrid
   float indexToObject[12];    // Row-major transformation matrix, 3x4,
                               // rotation-shear-scale | translation
   vkl_uint64 totalNumLeaves;  // The total number of leaf nodes in this tree.
-  bool allLeavesCompact;      // If all leaves have compact (non-strided) data
   vkl_uint64
       numLeaves[VKL_VDB_NUM_LEVELS];  // The number of leaf nodes per level.
   vkl_uint64 maxVoxelOffset;  // Used to select 64bit or 32bit traversal. TODO:
@@ -56,6 +55,7 @@ struct VdbGrid
   vec3i rootOrigin;           // In index space.
   vkl_uint32
       *usageBuffer;  // Nonzero if the given input leaf has been accessed.
+  void *stats;        // Per-volume work counters, or null if disabled.
   VdbLevel levels[VKL_VDB_NUM_LEVELS - 1];
 };
 
@@ -107,8 +107,8 @@ __vkl_interop_univary(__vkl_vdb_xfm_functions)
     // empty    : 00 ... 00000
     // tile     : VV ... 00001 (32 bit tile value, 30 bit empty, 2 bit type)
     // child    : II ... III10 (62 bit index,   2 bit node type)
-    // leaf     : PP ... PTT11 (60 bit pointer, 2 bit time format, 2 bit node
-    // type)
+    // leaf     : PP ... PSF11 (60 bit pointer, 1 bit strided flag, 1 bit
+    // format, 2 bit node type)
     //
     // - Child node indices are extracted by masking the lower two bits. This
     // means that indices must be multiples of 4 (which is always true given
@@ -123,9 +123,14 @@ __vkl_interop_univary(__vkl_vdb_xfm_functions)
     // - Timesteps can be 00 (temporally unstructured), 01 (const), or 10
     // (temporally structured).
     //
-    // - The lower 4 bits of leaf pointers are used for timestep and type
+    // - The lower 4 bits of leaf pointers are used for format and type
     // information, which means that leaf data pointers must be aligned to 16
-    // byte boundaries. VKLVdb will reject other pointers.
+    // byte boundaries.
+    //
+    // - Leaf pointers with the strided flag set point to a Data1D describing
+    // the leaf data, and otherwise directly to compact voxel values. This lets
+    // leaves with strided or unaligned shared data be sampled in place, while
+    // all other leaves keep the direct access path.
     // ==========================================================================
     // //
 
@@ -183,13 +188,17 @@ __vkl_interop_univary(__vkl_vdb_xfm_functions)
   }                                                                            \
                                                                                \
   inline univary vkl_uint64 vklVdbVoxelMakeLeafPtr(                            \
-      const void *univary leafPtr, univary VKLFormat format)                   \
+      const void *univary leafPtr,                                             \
+      univary VKLFormat format,                                                \
+      univary bool strided)                                                    \
   {                                                                            \
     const univary vkl_uint64 intptr = ((univary vkl_uint64)leafPtr);           \
     assert((intptr & 0xFu) == 0); /* Require 16 Byte alignment! */             \
+    assert(((vkl_uint32)format) <= 0x1u);                                      \
     const univary vkl_uint64 voxel =                                           \
         (intptr & ~((univary vkl_uint64)0xFu)) +                               \
-        ((((univary vkl_uint64)format) & 0x3u) << 2) + 0x3u;                   \
+        (strided ? 0x8u : 0x0u) +                                              \
+        ((((univary vkl_uint64)format) & 0x1u) << 2) + 0x3u;                   \
     assert((const void *univary)(voxel & ~((univary vkl_uint64)0xFu)) ==       \
            leafPtr);                                                           \
     return voxel;                                                              \
@@ -203,8 +212,14 @@ __vkl_interop_univary(__vkl_vdb_xfm_functions)
   inline univary VKLFormat vklVdbVoxelLeafGetFormat(                           \
       univary vkl_uint32 voxel)                                                \
   {                                                                            \
-    return ((VKLFormat)((voxel >> 2) & 0x3u));                                 \
+    return ((VKLFormat)((voxel >> 2) & 0x1u));                                 \
   }                                                                            \
+                                                                               \
+  inline univary bool vklVdbVoxelLeafIsStrided(univary vkl_uint32 voxel)       \
+  {                                                                            \
+    return ((voxel & 0x8u) != 0x0u);                                           \
+  }                                                                            \
+                                                                               \
   /* Leaf pointers are always 64 bit */                                        \
   inline const void *univary vklVdbVoxelLeafGetPtr(univary vkl_uint64 voxel)   \
   {                                                                            \
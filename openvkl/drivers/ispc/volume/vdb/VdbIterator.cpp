@@ -41,6 +41,49 @@ namespace openvkl {
                 static_cast<int *>(result));
     }
 
+    template <int W>
+    void VdbIntervalIterator<W>::initializeIntervalU(
+        const vvec3fn<1> &origin,
+        const vvec3fn<1> &direction,
+        const vrange1fn<1> &tRange,
+        const ValueSelector<W> *valueSelector)
+    {
+      const auto *vdbVolume = dynamic_cast<const VdbVolume<W> *>(volume);
+      CALL_ISPC(VdbIteratorU_Initialize,
+                ispcStorage,
+                vdbVolume->getGrid(),
+                (void *)&origin,
+                (void *)&direction,
+                (void *)&tRange,
+                valueSelector ? valueSelector->getISPCEquivalent() : nullptr);
+    }
+
+    template <int W>
+    void VdbIntervalIterator<W>::iterateIntervalU(vVKLIntervalN<1> &interval,
+                                                  vintn<1> &result)
+    {
+      CALL_ISPC(VdbIteratorU_iterateInterval,
+                ispcStorage,
+                &interval,
+                static_cast<int *>(result));
+    }
+
+    template <int W>
+    void VdbIntervalIterator<W>::setTRangeV(const vintn<W> &valid,
+                                            const vrange1fn<W> &tRange)
+    {
+      CALL_ISPC(VdbIterator_setTRange,
+                static_cast<const int *>(valid),
+                ispcStorage,
+                (void *)&tRange);
+    }
+
+    template <int W>
+    void VdbIntervalIterator<W>::setTRangeU(const vrange1fn<1> &tRange)
+    {
+      CALL_ISPC(VdbIteratorU_setTRange, ispcStorage, (void *)&tRange);
+    }
+
     template class VdbIntervalIterator<VKL_TARGET_WIDTH>;
 
   }  // namespace ispc_driver
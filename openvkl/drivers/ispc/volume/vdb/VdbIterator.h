@@ -29,6 +29,20 @@ namespace openvkl {
                             vVKLIntervalN<W> &interval,
                             vintn<W> &result) override final;
 
+      void setTRangeV(const vintn<W> &valid,
+                      const vrange1fn<W> &tRange) override final;
+
+      void initializeIntervalU(
+          const vvec3fn<1> &origin,
+          const vvec3fn<1> &direction,
+          const vrange1fn<1> &tRange,
+          const ValueSelector<W> *valueSelector) override final;
+
+      void iterateIntervalU(vVKLIntervalN<1> &interval,
+                            vintn<1> &result) override final;
+
+      void setTRangeU(const vrange1fn<1> &tRange) override final;
+
       void *getIspcStorage() override final
       {
         return reinterpret_cast<void*>(ispcStorage);
@@ -9,9 +9,10 @@ namespace openvkl {
   namespace ispc_driver {
 
     template <int W>
-    VdbSampler<W>::VdbSampler(const VdbGrid *grid,
+    VdbSampler<W>::VdbSampler(const Volume<W> &volume,
+                              const VdbGrid *grid,
                               const VdbSampleConfig &defaultConfig)
-        : grid(grid), config(defaultConfig)
+        : Sampler<W>(volume), grid(grid), config(defaultConfig)
     {
     }
 
@@ -99,6 +100,31 @@ namespace openvkl {
                 (ispc::vec3f *)gradients);
     }
 
+    template <int W>
+    VKLSamplerFunctions VdbSampler<W>::getFunctions() const
+    {
+      VKLSamplerFunctions functions = Sampler<W>::getFunctions();
+      functions.computeSample       = computeSampleVdb;
+      return functions;
+    }
+
+    template <int W>
+    float VdbSampler<W>::computeSampleVdb(VKLSampler sampler,
+                                          const vkl_vec3f *objectCoordinates)
+    {
+      const auto &samplerObject = referenceFromHandle<VdbSampler<W>>(sampler);
+
+      addStats(samplerObject.getStats(), VKL_STATS_SAMPLES, 1);
+
+      float sample;
+      CALL_ISPC(VdbSampler_computeSample_uniform,
+                samplerObject.grid,
+                &samplerObject.config,
+                objectCoordinates,
+                &sample);
+      return sample;
+    }
+
     template struct VdbSampler<VKL_TARGET_WIDTH>;
 
   }  // namespace ispc_driver
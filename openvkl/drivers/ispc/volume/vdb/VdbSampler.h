@@ -16,7 +16,9 @@ namespace openvkl {
     template <int W>
     struct VdbSampler : public Sampler<W>
     {
-      VdbSampler(const VdbGrid *grid, const VdbSampleConfig &defaultConfig);
+      VdbSampler(const Volume<W> &volume,
+                 const VdbGrid *grid,
+                 const VdbSampleConfig &defaultConfig);
 
       ~VdbSampler() override;
 
@@ -41,8 +43,14 @@ namespace openvkl {
                             const vvec3fn<1> *objectCoordinates,
                             vvec3fn<1> *gradients) const override final;
 
+      VKLSamplerFunctions getFunctions() const override final;
+
       const VdbGrid *grid{nullptr};
       VdbSampleConfig config;
+
+     private:
+      static float computeSampleVdb(VKLSampler sampler,
+                                    const vkl_vec3f *objectCoordinates);
     };
 
   }  // namespace ispc_driver
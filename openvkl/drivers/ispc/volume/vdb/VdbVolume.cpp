@@ -5,7 +5,9 @@
 #include <cstring>
 #include <set>
 #include "../../common/export_util.h"
+#include "../common/allocation.h"
 #include "../common/logging.h"
+#include "../common/tracing.h"
 #include "VdbLeafAccessObserver.h"
 #include "VdbSampler.h"
 #include "VdbSampler_ispc.h"
@@ -25,17 +27,14 @@ namespace openvkl {
     {
       const size_t numBytes = size * sizeof(T);
       bytesAllocated += numBytes;
-      T *buf = reinterpret_cast<T *>(rkcommon::memory::alignedMalloc(numBytes));
-      if (!buf)
-        throw std::bad_alloc();
-      std::memset(buf, 0, numBytes);
-      return buf;
+      return reinterpret_cast<T *>(
+          allocation::allocateZeroed(numBytes, VKL_ALLOCATION_ACCELERATOR));
     }
 
     template <class T>
     void deallocate(T *&ptr)
     {
-      rkcommon::memory::alignedFree(ptr);
+      allocation::deallocate(ptr);
       ptr = nullptr;
     }
 
@@ -45,6 +44,10 @@ namespace openvkl {
     VdbVolume<W>::VdbVolume()
     {
       this->ispcEquivalent = CALL_ISPC(VdbVolume_create);
+
+      if (!this->ispcEquivalent) {
+        throw std::bad_alloc();
+      }
     }
 
     template <int W>
@@ -288,6 +291,17 @@ namespace openvkl {
       }
     }
 
+    /*
+     * Leaf data can be referenced directly by leaf pointers if it is compact
+     * and suitably aligned. All other leaf data is sampled in place through
+     * an ispc::Data1D, so that shared buffers need not be copied.
+     */
+    inline bool isDirectLeafData(const Data &data)
+    {
+      return data.compact() &&
+             (reinterpret_cast<uintptr_t>(data.ispc.addr) & 0xFu) == 0;
+    }
+
     /*
      * Compute the value range for float leaves.
      */
@@ -384,12 +398,12 @@ namespace openvkl {
                 if (format == VKL_FORMAT_TILE) {
                   voxel = vklVdbVoxelMakeTile(leafData[idx]->as<float>()[0]);
                 } else if (format == VKL_FORMAT_CONSTANT_ZYX) {
-                  if (grid->allLeavesCompact) {
+                  if (isDirectLeafData(*leafData[idx])) {
                     voxel = vklVdbVoxelMakeLeafPtr(
-                        leafData[idx]->as<float>().data(), format);
+                        leafData[idx]->as<float>().data(), format, false);
                   } else {
-                    voxel =
-                        vklVdbVoxelMakeLeafPtr(&leafDataISPC[idx].data, format);
+                    voxel = vklVdbVoxelMakeLeafPtr(
+                        &leafDataISPC[idx].data, format, true);
                   }
                 } else
                   assert(false);
@@ -421,7 +435,7 @@ namespace openvkl {
       std::vector<range1f> valueRanges(leafFormat.size());
 
       const size_t numLeaves = leafOffsets.size();
-      tasking::parallel_for(numLeaves, [&](size_t idx) {
+      tracing::parallel_for("computeValueRange", numLeaves, [&](size_t idx) {
         const auto format    = static_cast<VKLFormat>(leafFormat[idx]);
         const vec3ui &offset = leafOffsets[idx];
         valueRanges.at(idx)  = computeValueRangeFloat(
@@ -492,6 +506,9 @@ namespace openvkl {
     template <int W>
     void VdbVolume<W>::commit()
     {
+      tracing::Scope scope("VdbVolume::commit");
+      tracing::Scope phase("validate");
+
       cleanup();
 
       const int maxIteratorDepth =
@@ -552,7 +569,7 @@ namespace openvkl {
             "the same size");
       }
 
-      tasking::parallel_for(numLeaves, [&](size_t i) {
+      tracing::parallel_for("validateNode", numLeaves, [&](size_t i) {
         const uint32_t level = (*leafLevel)[i];
         if (level >= vklVdbNumLevels()) {
           runtimeError(
@@ -584,21 +601,14 @@ namespace openvkl {
         }
       });
 
+      phase.next("initGrid");
+
       grid       = allocate<VdbGrid>(1, bytesAllocated);
       grid->type = type;
       grid->maxIteratorDepth =
           min(max(maxIteratorDepth, 0), VKL_VDB_NUM_LEVELS - 1);
       grid->totalNumLeaves = numLeaves;
-
-      // Determine if all leaf data is compact (non-strided)
-      grid->allLeavesCompact = true;
-
-      for (size_t i = 0; i < leafData->size(); i++) {
-        if (!(*leafData)[i]->compact()) {
-          grid->allLeavesCompact = false;
-          break;
-        }
-      }
+      grid->stats          = this->getStats();
 
       const AffineSpace3f indexToObject = loadTransform(dataIndexToObject);
       writeTransform(indexToObject, grid->indexToObject);
@@ -615,25 +625,33 @@ namespace openvkl {
       bounds.lower = xfmPoint(grid->indexToObject, vec3f(bbox.lower));
       bounds.upper = xfmPoint(grid->indexToObject, vec3f(bbox.upper));
 
+      phase.next("binLeaves");
+
       const auto binnedLeaves = binLeavesPerLevel(numLeaves, *leafLevel);
       for (size_t i = 0; i < vklVdbNumLevels(); ++i)
         grid->numLeaves[i] = binnedLeaves[i].size();
       const auto leafOffsets =
           computeLeafOffsets(numLeaves, *leafOrigin, grid->rootOrigin);
 
+      phase.next("allocateInnerLevels");
+
       // Allocate buffers for all levels now, all in one go. This makes
       // inserting the nodes (below) much faster.
       std::vector<uint64_t> capacity(vklVdbNumLevels() - 1, 0);
       allocateInnerLevels(
           leafOffsets, binnedLeaves, capacity, grid, bytesAllocated);
 
-      // Populate contiguous ispc::Data1D objects to be used in leaf pointers,
-      // only needed if we have strided data
-      if (!grid->allLeavesCompact) {
-        leafDataISPC.resize(leafData->size());
+      phase.next("insertLeaves");
 
-        for (size_t i = 0; i < leafDataISPC.size(); i++) {
-          leafDataISPC[i].data = (*leafData)[i]->template as<float>().ispc;
+      // Populate aligned ispc::Data1D objects to be used in leaf pointers,
+      // only needed for leaves that cannot reference their data directly
+      leafDataISPC.clear();
+
+      for (size_t i = 0; i < leafData->size(); i++) {
+        const Data &data = *(*leafData)[i];
+        if (!isDirectLeafData(data)) {
+          leafDataISPC.resize(leafData->size());
+          leafDataISPC[i].data = data.template as<float>().ispc;
         }
       }
 
@@ -651,12 +669,21 @@ namespace openvkl {
                 reinterpret_cast<const ispc::VdbGrid *>(grid),
                 reinterpret_cast<const ispc::VdbSampleConfig *>(&globalConfig));
 
+      phase.next("computeValueRanges");
+
       computeValueRangesFloat(
           leafOffsets, *leafLevel, *leafFormat, *leafData, grid);
 
       valueRange = range1f();
       for (size_t i = 0; i < vklVdbLevelNumVoxels(0); ++i)
         valueRange.extend(grid->levels[0].valueRange[i]);
+
+      this->setMemoryUsage(
+          this->ownedBytes(leafData) + this->ownedBytes(leafLevel) +
+              this->ownedBytes(leafOrigin) + this->ownedBytes(leafFormat) +
+              this->ownedBytes(dataIndexToObject),
+          bytesAllocated,
+          leafDataISPC.capacity() * sizeof(AlignedISPCData1D));
     }
 
     template <int W>
@@ -669,9 +696,13 @@ namespace openvkl {
 
       const std::string t(type);
       if (t == "LeafNodeAccess") {
-        if (!grid->usageBuffer)
+        if (!grid->usageBuffer) {
           grid->usageBuffer =
               allocate<uint32>(grid->totalNumLeaves, bytesAllocated);
+
+          const VKLMemoryUsage usage = this->getMemoryUsage();
+          this->setMemoryUsage(usage.data, bytesAllocated, usage.auxiliary);
+        }
         return (VKLObserver) new VdbLeafAccessObserver(
             *this, grid->totalNumLeaves, grid->usageBuffer);
       } else {
@@ -682,7 +713,17 @@ namespace openvkl {
     template <int W>
     Sampler<W> *VdbVolume<W>::newSampler()
     {
-      return new VdbSampler<W>(grid, globalConfig);
+      return new VdbSampler<W>(*this, grid, globalConfig);
+    }
+
+    template <int W>
+    void VdbVolume<W>::setStats(VolumeStats *stats)
+    {
+      Volume<W>::setStats(stats);
+
+      // the grid is traversed without access to the volume
+      if (grid)
+        grid->stats = stats;
     }
 
     VKL_REGISTER_VOLUME(VdbVolume<VKL_TARGET_WIDTH>,
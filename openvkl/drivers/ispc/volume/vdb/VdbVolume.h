@@ -87,6 +87,9 @@ namespace openvkl {
         return hitIteratorFactory;
       }
 
+     protected:
+      void setStats(VolumeStats *stats) override;
+
      private:
       void cleanup();
 
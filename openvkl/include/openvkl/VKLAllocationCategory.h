@@ -0,0 +1,25 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ispc_cpp_interop.h"
+
+// ========================================================================== //
+// The kinds of buffers Open VKL allocates for its own use.
+// ========================================================================== //
+enum VKLAllocationCategory
+#if __cplusplus >= 201103L
+: vkl_uint32
+#endif
+{
+  // Owned copies of application data (VKL_DATA_DEFAULT).
+  VKL_ALLOCATION_DATA = 0,
+  // Acceleration structures built on commit, such as macrocell grids and
+  // VDB node arrays.
+  VKL_ALLOCATION_ACCELERATOR,
+  // Other derived data.
+  VKL_ALLOCATION_AUXILIARY,
+  // The number of categories.
+  VKL_ALLOCATION_NUM_CATEGORIES
+};
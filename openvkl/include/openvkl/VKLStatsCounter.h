@@ -0,0 +1,34 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ispc_cpp_interop.h"
+
+// ========================================================================== //
+// Indices into the buffer returned by the "Stats" volume observer.
+// ========================================================================== //
+enum VKLStatsCounter
+#if __cplusplus >= 201103L
+: vkl_uint32
+#endif
+{
+  // Samples and gradients computed through the sampler API.
+  VKL_STATS_SAMPLES = 0,
+  VKL_STATS_GRADIENTS,
+  // Inner nodes of BVHs, k-d trees and VDB trees visited during sampling and
+  // iteration.
+  VKL_STATS_NODES_VISITED,
+  // Leaf nodes reached during sampling and iteration.
+  VKL_STATS_LEAVES_VISITED,
+  // Cells tested during sampling and iteration, such as unstructured cells
+  // tested for containment, or macro cells stepped through by iterators.
+  VKL_STATS_CELLS_TESTED,
+  // Intervals and hits returned by iterators.
+  VKL_STATS_INTERVALS,
+  VKL_STATS_HITS,
+  // Iterations spent refining isosurface hits.
+  VKL_STATS_HIT_REFINEMENT_ITERATIONS,
+  // The number of counters.
+  VKL_STATS_NUM_COUNTERS
+};
@@ -42,6 +42,16 @@ OPENVKL_INTERFACE VKLData vklNewData(size_t numItems,
                                          VKL_DEFAULT_VAL(= VKL_DATA_DEFAULT),
                                      size_t byteStride VKL_DEFAULT_VAL(= 0));
 
+// creates an Open VKL owned data array of dataType elements from source
+// elements of sourceType; supported are identical types (compacting strided
+// input) and VKL_DOUBLE to VKL_FLOAT
+OPENVKL_INTERFACE VKLData vklNewDataConverted(size_t numItems,
+                                              VKLDataType dataType,
+                                              const void *source,
+                                              VKLDataType sourceType,
+                                              size_t sourceByteStride
+                                                  VKL_DEFAULT_VAL(= 0));
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -3,6 +3,13 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#include <cstddef>
+#else
+#include <stddef.h>
+#endif
+
+#include "VKLAllocationCategory.h"
 #include "common.h"
 
 struct Driver;
@@ -20,6 +27,26 @@ OPENVKL_INTERFACE void vklDriverSetLogFunc(VKLDriver driver, VKLLogFunc func);
 typedef void (*VKLErrorFunc)(VKLError error, const char *message);
 OPENVKL_INTERFACE void vklDriverSetErrorFunc(VKLDriver, VKLErrorFunc func);
 
+// Allocator for the buffers Open VKL allocates internally. Returned buffers
+// must be aligned to at least `alignment` bytes; returning NULL fails the
+// calling API function with VKL_OUT_OF_MEMORY. The free function receives the
+// size and category passed to the matching allocation.
+typedef void *(*VKLAllocateFunc)(void *userData,
+                                 size_t numBytes,
+                                 size_t alignment,
+                                 VKLAllocationCategory category);
+typedef void (*VKLFreeFunc)(void *userData,
+                            void *ptr,
+                            size_t numBytes,
+                            VKLAllocationCategory category);
+
+// Takes effect on vklCommitDriver(); passing NULL functions restores the
+// default allocator.
+OPENVKL_INTERFACE void vklDriverSetAllocator(VKLDriver driver,
+                                             VKLAllocateFunc allocateFunc,
+                                             VKLFreeFunc freeFunc,
+                                             void *userData);
+
 OPENVKL_INTERFACE void vklDriverSetInt(VKLDriver driver,
                                        const char *name,
                                        int x);
@@ -46,6 +73,23 @@ OPENVKL_INTERFACE void vklRelease(VKLObject object);
 
 OPENVKL_INTERFACE void vklShutdown();
 
+// Buffers of one allocation category that are currently allocated
+typedef struct
+{
+  size_t numBuffers;
+  size_t bytes;
+
+  // buffers for which huge pages were obtained (explicit huge pages) or
+  // requested (transparent huge pages); see the hugePages driver parameter
+  size_t numHugePageBuffers;
+  size_t hugePageBytes;
+} VKLAllocationStats;
+
+// Returns statistics on the buffers of the given category that Open VKL
+// currently holds, over all drivers.
+OPENVKL_INTERFACE VKLAllocationStats
+vklGetAllocationStats(VKLAllocationCategory category);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -109,6 +109,7 @@ typedef struct
   vkl_range1f tRange;
   vkl_range1f valueRange;
   float nominalDeltaT;
+  float majorant;
 } VKLInterval;
 
 typedef struct VKL_ALIGN(16)
@@ -116,6 +117,7 @@ typedef struct VKL_ALIGN(16)
   vkl_vrange1f4 tRange;
   vkl_vrange1f4 valueRange;
   float nominalDeltaT[4];
+  float majorant[4];
 } VKLInterval4;
 
 typedef struct VKL_ALIGN(32)
@@ -123,6 +125,7 @@ typedef struct VKL_ALIGN(32)
   vkl_vrange1f8 tRange;
   vkl_vrange1f8 valueRange;
   float nominalDeltaT[8];
+  float majorant[8];
 } VKLInterval8;
 
 typedef struct VKL_ALIGN(64)
@@ -130,6 +133,7 @@ typedef struct VKL_ALIGN(64)
   vkl_vrange1f16 tRange;
   vkl_vrange1f16 valueRange;
   float nominalDeltaT[16];
+  float majorant[16];
 } VKLInterval16;
 
 // returns true while the iterator is still within the volume
@@ -154,6 +158,64 @@ void vklIterateInterval16(const int *valid,
                           VKLInterval16 *interval,
                           int *result);
 
+/*
+ * Restrict the remaining t range of a live interval iterator.
+ *
+ * The new range is intersected with the range the iterator has left to
+ * traverse, so it can only shrink; this is useful e.g. for shortening a ray
+ * once an opaque surface has been found, or for skipping ahead. Intervals
+ * returned afterwards do not start outside of the new range. Iteration may
+ * be resumed immediately with vklIterateInterval*().
+ */
+OPENVKL_INTERFACE
+void vklSetIntervalIteratorTRange(VKLIntervalIterator iterator,
+                                  const vkl_range1f *tRange);
+
+OPENVKL_INTERFACE
+void vklSetIntervalIteratorTRange4(const int *valid,
+                                   VKLIntervalIterator4 iterator,
+                                   const vkl_vrange1f4 *tRange);
+
+OPENVKL_INTERFACE
+void vklSetIntervalIteratorTRange8(const int *valid,
+                                   VKLIntervalIterator8 iterator,
+                                   const vkl_vrange1f8 *tRange);
+
+OPENVKL_INTERFACE
+void vklSetIntervalIteratorTRange16(const int *valid,
+                                    VKLIntervalIterator16 iterator,
+                                    const vkl_vrange1f16 *tRange);
+
+/*
+ * Stream interval iteration.
+ *
+ * Iterates intervals for N rays, given as arrays of length N. The callback is
+ * invoked once for every interval found, with the index of the ray in the
+ * input arrays; it should return nonzero to continue iterating the ray, or
+ * zero to terminate it. Intervals of a given ray are reported in order, but
+ * the callbacks of different rays are interleaved.
+ *
+ * Rays are processed in packets of the native SIMD width. Whenever too many
+ * rays in a packet have terminated, the remaining rays are regrouped with
+ * rays that have not been started yet, so that packets stay full. Regrouped
+ * rays restart at the end of their last interval, so interval boundaries may
+ * differ from those produced by the other iterator APIs. Empty intervals are
+ * never reported.
+ */
+typedef int (*VKLIntervalStreamFunc)(void *userData,
+                                     unsigned int rayIndex,
+                                     const VKLInterval *interval);
+
+OPENVKL_INTERFACE
+void vklIterateIntervalN(VKLVolume volume,
+                         unsigned int N,
+                         const vkl_vec3f *origin,
+                         const vkl_vec3f *direction,
+                         const vkl_range1f *tRange,
+                         VKLValueSelector valueSelector,
+                         VKLIntervalStreamFunc callback,
+                         void *userData);
+
 ///////////////////////////////////////////////////////////////////////////////
 // Hit iterators //////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -292,6 +354,60 @@ void vklIterateHit16(const int *valid,
                      VKLHit16 *hit,
                      int *result);
 
+/*
+ * Find up to maxHits hits in a single call, and write them to the hits array
+ * in order along the ray. Returns the number of hits written; a value smaller
+ * than maxHits means that the iterator has left the volume. The iterator can
+ * be used to continue iteration afterwards, either with vklIterateHits() or
+ * with vklIterateHit().
+ */
+OPENVKL_INTERFACE
+unsigned int vklIterateHits(VKLHitIterator iterator,
+                            unsigned int maxHits,
+                            VKLHit *hits);
+
+/*
+ * Restrict the remaining t range of a live hit iterator; see
+ * vklSetIntervalIteratorTRange() above. Hits outside of the new range are
+ * not reported.
+ */
+OPENVKL_INTERFACE
+void vklSetHitIteratorTRange(VKLHitIterator iterator,
+                             const vkl_range1f *tRange);
+
+OPENVKL_INTERFACE
+void vklSetHitIteratorTRange4(const int *valid,
+                              VKLHitIterator4 iterator,
+                              const vkl_vrange1f4 *tRange);
+
+OPENVKL_INTERFACE
+void vklSetHitIteratorTRange8(const int *valid,
+                              VKLHitIterator8 iterator,
+                              const vkl_vrange1f8 *tRange);
+
+OPENVKL_INTERFACE
+void vklSetHitIteratorTRange16(const int *valid,
+                               VKLHitIterator16 iterator,
+                               const vkl_vrange1f16 *tRange);
+
+/*
+ * Stream hit iteration; see vklIterateIntervalN() above. Regrouped rays
+ * restart at t + epsilon of their last hit.
+ */
+typedef int (*VKLHitStreamFunc)(void *userData,
+                                unsigned int rayIndex,
+                                const VKLHit *hit);
+
+OPENVKL_INTERFACE
+void vklIterateHitN(VKLVolume volume,
+                    unsigned int N,
+                    const vkl_vec3f *origin,
+                    const vkl_vec3f *direction,
+                    const vkl_range1f *tRange,
+                    VKLValueSelector valueSelector,
+                    VKLHitStreamFunc callback,
+                    void *userData);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
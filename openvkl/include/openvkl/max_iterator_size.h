@@ -5,9 +5,9 @@
 
 // Maximum iterator size over all supported volume and driver
 // types, and for each target SIMD width.
-#define VKL_MAX_INTERVAL_ITERATOR_SIZE_4 1535
-#define VKL_MAX_INTERVAL_ITERATOR_SIZE_8 3071
-#define VKL_MAX_INTERVAL_ITERATOR_SIZE_16 6143
+#define VKL_MAX_INTERVAL_ITERATOR_SIZE_4 1151
+#define VKL_MAX_INTERVAL_ITERATOR_SIZE_8 2303
+#define VKL_MAX_INTERVAL_ITERATOR_SIZE_16 4607
 
 #if defined(TARGET_WIDTH) && (TARGET_WIDTH == 4)
   #define VKL_MAX_INTERVAL_ITERATOR_SIZE VKL_MAX_INTERVAL_ITERATOR_SIZE_4
@@ -16,9 +16,9 @@
 #else
   #define VKL_MAX_INTERVAL_ITERATOR_SIZE VKL_MAX_INTERVAL_ITERATOR_SIZE_16
 #endif
-#define VKL_MAX_HIT_ITERATOR_SIZE_4 1791
-#define VKL_MAX_HIT_ITERATOR_SIZE_8 3583
-#define VKL_MAX_HIT_ITERATOR_SIZE_16 7167
+#define VKL_MAX_HIT_ITERATOR_SIZE_4 1407
+#define VKL_MAX_HIT_ITERATOR_SIZE_8 2815
+#define VKL_MAX_HIT_ITERATOR_SIZE_16 5631
 
 #if defined(TARGET_WIDTH) && (TARGET_WIDTH == 4)
   #define VKL_MAX_HIT_ITERATOR_SIZE VKL_MAX_HIT_ITERATOR_SIZE_4
@@ -3,11 +3,13 @@
 
 #pragma once
 
+#include "VKLAllocationCategory.h"
 #include "VKLDataType.h"
 #include "VKLError.h"
 #include "VKLFilter.h"
 #include "VKLFormat.h"
 #include "VKLLogLevel.h"
+#include "VKLStatsCounter.h"
 
 #include "common.h"
 #include "data.h"
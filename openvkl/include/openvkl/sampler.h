@@ -84,6 +84,34 @@ void vklComputeGradientN(VKLSampler sampler,
                          const vkl_vec3f *objectCoordinates,
                          vkl_vec3f *gradients);
 
+/*
+ * Direct scalar entry points of a sampler.
+ *
+ * The functions returned by vklGetSamplerFunctions() are called with the
+ * sampler they were retrieved from, and sample it without going through the
+ * current driver or any error handling: they must only be called with valid
+ * arguments, and report no errors. This removes most of the per-call overhead
+ * of vklComputeSample() and vklComputeGradient(), which matters for cheap
+ * scalar lookups.
+ *
+ * The functions remain valid as long as the sampler is alive, but must be
+ * queried again after the sampler or its volume is committed.
+ */
+typedef float (*VKLComputeSampleFunc)(VKLSampler sampler,
+                                      const vkl_vec3f *objectCoordinates);
+
+typedef vkl_vec3f (*VKLComputeGradientFunc)(
+    VKLSampler sampler, const vkl_vec3f *objectCoordinates);
+
+typedef struct
+{
+  VKLComputeSampleFunc computeSample;
+  VKLComputeGradientFunc computeGradient;
+} VKLSamplerFunctions;
+
+OPENVKL_INTERFACE
+VKLSamplerFunctions vklGetSamplerFunctions(VKLSampler sampler);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
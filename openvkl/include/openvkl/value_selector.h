@@ -32,6 +32,12 @@ void vklValueSelectorSetValues(VKLValueSelector valueSelector,
                                size_t numValues,
                                const float *values);
 
+OPENVKL_INTERFACE
+void vklValueSelectorSetOpacities(VKLValueSelector valueSelector,
+                                  const vkl_range1f *valueRange,
+                                  size_t numOpacities,
+                                  const float *opacities);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -58,6 +58,31 @@ vkl_box3f vklGetBoundingBox(VKLVolume volume);
 
 OPENVKL_INTERFACE vkl_range1f vklGetValueRange(VKLVolume volume);
 
+// Memory used by a volume, in bytes
+typedef struct
+{
+  // application data copied into VKLData objects referenced by the volume;
+  // shared buffers (VKL_DATA_SHARED_BUFFER) are not counted
+  size_t data;
+
+  // acceleration structures built on commit (macrocell grids, BVH nodes,
+  // k-d trees, VDB levels)
+  size_t accelerator;
+
+  // other derived data (e.g. precomputed face normals, AMR brick descriptors)
+  size_t auxiliary;
+
+  // sum of the above
+  size_t total;
+} VKLMemoryUsage;
+
+// Returns the memory used by the given committed volume.
+OPENVKL_INTERFACE VKLMemoryUsage vklGetVolumeMemoryUsage(VKLVolume volume);
+
+// Returns the combined memory usage of all volumes that currently exist and
+// were created by the current driver.
+OPENVKL_INTERFACE VKLMemoryUsage vklGetTotalVolumeMemoryUsage();
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -0,0 +1,635 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "memory.h"
+#include "utility.h"
+#include "rkcommon/tasking/parallel_for.h"
+
+/*
+ * Benchmarks for vklCommit() on volumes, i.e. the cost of building
+ * acceleration structures.
+ */
+
+/*
+ * Commit fixtures.
+ *
+ * A fixture generates the input data for a volume with (approximately) the
+ * requested number of elements once. newVolume() returns a new volume handle
+ * with all parameters set, which has not been committed yet.
+ *
+ * The required interface is:
+ *
+ * static std::string name(): A string that is used to generate test names.
+ * size_t numElements() const: The actual number of voxels, cells or particles.
+ * size_t inputBytes() const: The size of the input data.
+ * VKLVolume newVolume() const: A new, uncommitted volume.
+ */
+namespace commit_fixture {
+
+  using namespace rkcommon::math;
+  using openvkl::testing::getWaveletValue;
+
+  // the edge length of a cubic grid with approximately n elements
+  inline int cubeRoot(size_t n)
+  {
+    return std::max(2, static_cast<int>(std::round(std::cbrt(double(n)))));
+  }
+
+  // round x up to the next multiple of m
+  inline int roundUp(int x, int m)
+  {
+    return ((x + m - 1) / m) * m;
+  }
+
+  template <typename T>
+  inline VKLData newSharedData(const std::vector<T> &v, VKLDataType type)
+  {
+    return vklNewData(v.size(), type, v.data(), VKL_DATA_SHARED_BUFFER);
+  }
+
+  template <typename T>
+  inline size_t bytes(const std::vector<T> &v)
+  {
+    return v.size() * sizeof(T);
+  }
+
+  /*
+   * Structured volumes on a wavelet field; the GridAccelerator is built on
+   * commit.
+   */
+  template <bool spherical>
+  struct Structured
+  {
+    static std::string name()
+    {
+      return spherical ? "structuredSpherical" : "structuredRegular";
+    }
+
+    explicit Structured(size_t n) : dimensions(cubeRoot(n))
+    {
+      if (spherical) {
+        gridOrigin  = vec3f(0.f);
+        // radial distance, inclination angle, azimuthal angle
+        gridSpacing = vec3f(1.f / (dimensions.x - 1),
+                            180.f / (dimensions.y - 1),
+                            360.f / (dimensions.z - 1));
+      } else {
+        gridOrigin  = vec3f(-1.f);
+        gridSpacing = vec3f(2.f / (dimensions.x - 1));
+      }
+
+      voxels.resize(dimensions.long_product());
+
+      rkcommon::tasking::parallel_for(dimensions.z, [&](int z) {
+        for (int y = 0; y < dimensions.y; y++) {
+          for (int x = 0; x < dimensions.x; x++) {
+            const size_t index =
+                size_t(z) * dimensions.y * dimensions.x +
+                size_t(y) * dimensions.x + x;
+            voxels[index] = getWaveletValue<float>(
+                vec3f(x, y, z) * (8.f / dimensions.x));
+          }
+        }
+      });
+
+      data = newSharedData(voxels, VKL_FLOAT);
+    }
+
+    ~Structured()
+    {
+      vklRelease(data);
+    }
+
+    size_t numElements() const
+    {
+      return voxels.size();
+    }
+
+    size_t inputBytes() const
+    {
+      return bytes(voxels);
+    }
+
+    VKLVolume newVolume() const
+    {
+      VKLVolume volume =
+          vklNewVolume(spherical ? "structuredSpherical" : "structuredRegular");
+      vklSetVec3i(
+          volume, "dimensions", dimensions.x, dimensions.y, dimensions.z);
+      vklSetVec3f(
+          volume, "gridOrigin", gridOrigin.x, gridOrigin.y, gridOrigin.z);
+      vklSetVec3f(
+          volume, "gridSpacing", gridSpacing.x, gridSpacing.y, gridSpacing.z);
+      vklSetData(volume, "data", data);
+      return volume;
+    }
+
+    vec3i dimensions;
+    vec3f gridOrigin;
+    vec3f gridSpacing;
+    std::vector<float> voxels;
+    VKLData data{nullptr};
+  };
+
+  /*
+   * Unstructured hexahedral grids; the Embree BVH is built on commit.
+   */
+  struct Unstructured
+  {
+    static std::string name()
+    {
+      return "unstructured";
+    }
+
+    explicit Unstructured(size_t n) : dimensions(cubeRoot(n))
+    {
+      const vec3i numVertices = dimensions + 1;
+      const size_t numCells   = dimensions.long_product();
+
+      positions.resize(numVertices.long_product());
+
+      rkcommon::tasking::parallel_for(numVertices.z, [&](int z) {
+        for (int y = 0; y < numVertices.y; y++) {
+          for (int x = 0; x < numVertices.x; x++) {
+            positions[(size_t(z) * numVertices.y + y) * numVertices.x + x] =
+                vec3f(x, y, z);
+          }
+        }
+      });
+
+      index.resize(8 * numCells);
+      cellIndex.resize(numCells);
+      cellType.resize(numCells, VKL_HEXAHEDRON);
+      cellValues.resize(numCells);
+
+      rkcommon::tasking::parallel_for(dimensions.z, [&](int z) {
+        auto vertex = [&](int i, int j, int k) {
+          return uint32_t((size_t(k) * numVertices.y + j) * numVertices.x + i);
+        };
+
+        for (int y = 0; y < dimensions.y; y++) {
+          for (int x = 0; x < dimensions.x; x++) {
+            const size_t c =
+                (size_t(z) * dimensions.y + y) * dimensions.x + x;
+
+            // VTK_HEXAHEDRON ordering
+            uint32_t *cell = index.data() + 8 * c;
+            cell[0]        = vertex(x, y, z);
+            cell[1]        = vertex(x + 1, y, z);
+            cell[2]        = vertex(x + 1, y + 1, z);
+            cell[3]        = vertex(x, y + 1, z);
+            cell[4]        = vertex(x, y, z + 1);
+            cell[5]        = vertex(x + 1, y, z + 1);
+            cell[6]        = vertex(x + 1, y + 1, z + 1);
+            cell[7]        = vertex(x, y + 1, z + 1);
+
+            cellIndex[c]  = 8 * c;
+            cellValues[c] = getWaveletValue<float>(
+                vec3f(x, y, z) * (8.f / dimensions.x));
+          }
+        }
+      });
+
+      positionData  = newSharedData(positions, VKL_VEC3F);
+      indexData     = newSharedData(index, VKL_UINT);
+      cellIndexData = newSharedData(cellIndex, VKL_ULONG);
+      cellTypeData  = newSharedData(cellType, VKL_UCHAR);
+      cellValueData = newSharedData(cellValues, VKL_FLOAT);
+    }
+
+    ~Unstructured()
+    {
+      vklRelease(positionData);
+      vklRelease(indexData);
+      vklRelease(cellIndexData);
+      vklRelease(cellTypeData);
+      vklRelease(cellValueData);
+    }
+
+    size_t numElements() const
+    {
+      return cellIndex.size();
+    }
+
+    size_t inputBytes() const
+    {
+      return bytes(positions) + bytes(index) + bytes(cellIndex) +
+             bytes(cellType) + bytes(cellValues);
+    }
+
+    VKLVolume newVolume() const
+    {
+      VKLVolume volume = vklNewVolume("unstructured");
+      vklSetData(volume, "vertex.position", positionData);
+      vklSetData(volume, "index", indexData);
+      vklSetData(volume, "cell.index", cellIndexData);
+      vklSetData(volume, "cell.type", cellTypeData);
+      vklSetData(volume, "cell.data", cellValueData);
+      return volume;
+    }
+
+    vec3i dimensions;
+    std::vector<vec3f> positions;
+    std::vector<uint32_t> index;
+    std::vector<uint64_t> cellIndex;
+    std::vector<uint8_t> cellType;
+    std::vector<float> cellValues;
+
+    VKLData positionData{nullptr};
+    VKLData indexData{nullptr};
+    VKLData cellIndexData{nullptr};
+    VKLData cellTypeData{nullptr};
+    VKLData cellValueData{nullptr};
+  };
+
+  /*
+   * Randomly placed particles; the Embree BVH is built on commit.
+   */
+  struct Particle
+  {
+    static std::string name()
+    {
+      return "particle";
+    }
+
+    explicit Particle(size_t n) : positions(n), radii(n)
+    {
+      // keep the particle density constant over all sizes
+      const float extent = std::cbrt(float(n));
+
+      std::mt19937 eng(n);
+      std::uniform_real_distribution<float> dist(0.f, extent);
+
+      for (auto &p : positions)
+        p = vec3f(dist(eng), dist(eng), dist(eng));
+
+      std::fill(radii.begin(), radii.end(), 1.f);
+
+      positionData = newSharedData(positions, VKL_VEC3F);
+      radiusData   = newSharedData(radii, VKL_FLOAT);
+    }
+
+    ~Particle()
+    {
+      vklRelease(positionData);
+      vklRelease(radiusData);
+    }
+
+    size_t numElements() const
+    {
+      return positions.size();
+    }
+
+    size_t inputBytes() const
+    {
+      return bytes(positions) + bytes(radii);
+    }
+
+    VKLVolume newVolume() const
+    {
+      VKLVolume volume = vklNewVolume("particle");
+      vklSetData(volume, "particle.position", positionData);
+      vklSetData(volume, "particle.radius", radiusData);
+      return volume;
+    }
+
+    std::vector<vec3f> positions;
+    std::vector<float> radii;
+
+    VKLData positionData{nullptr};
+    VKLData radiusData{nullptr};
+  };
+
+  /*
+   * A single refinement level of 16^3 blocks; the AMR k-d tree is built on
+   * commit.
+   */
+  struct AMR
+  {
+    static std::string name()
+    {
+      return "amr";
+    }
+
+    static constexpr int blockSize = 16;
+
+    explicit AMR(size_t n)
+    {
+      const int numBlocksPerDim =
+          roundUp(cubeRoot(n), blockSize) / blockSize;
+      const size_t numBlockVoxels = blockSize * blockSize * blockSize;
+
+      for (int z = 0; z < numBlocksPerDim; z++) {
+        for (int y = 0; y < numBlocksPerDim; y++) {
+          for (int x = 0; x < numBlocksPerDim; x++) {
+            // block bound upper bounds are inclusive
+            const vec3i lower = vec3i(x, y, z) * blockSize;
+            blockBounds.emplace_back(lower, lower + (blockSize - 1));
+            blockLevels.push_back(0);
+          }
+        }
+      }
+
+      voxels.resize(blockBounds.size() * numBlockVoxels);
+
+      rkcommon::tasking::parallel_for(blockBounds.size(), [&](size_t b) {
+        const vec3i lower = blockBounds[b].lower;
+        float *block      = voxels.data() + b * numBlockVoxels;
+
+        for (int z = 0; z < blockSize; z++) {
+          for (int y = 0; y < blockSize; y++) {
+            for (int x = 0; x < blockSize; x++) {
+              const vec3i p = lower + vec3i(x, y, z);
+              block[(z * blockSize + y) * blockSize + x] =
+                  getWaveletValue<float>(vec3f(p) *
+                                         (8.f / (numBlocksPerDim * blockSize)));
+            }
+          }
+        }
+      });
+
+      for (size_t b = 0; b < blockBounds.size(); b++) {
+        blockData.push_back(vklNewData(numBlockVoxels,
+                                       VKL_FLOAT,
+                                       voxels.data() + b * numBlockVoxels,
+                                       VKL_DATA_SHARED_BUFFER));
+      }
+
+      cellWidths.push_back(1.f);
+
+      blockDataData   = newSharedData(blockData, VKL_DATA);
+      blockBoundsData = newSharedData(blockBounds, VKL_BOX3I);
+      blockLevelData  = newSharedData(blockLevels, VKL_INT);
+      cellWidthData   = newSharedData(cellWidths, VKL_FLOAT);
+    }
+
+    ~AMR()
+    {
+      vklRelease(blockDataData);
+      vklRelease(blockBoundsData);
+      vklRelease(blockLevelData);
+      vklRelease(cellWidthData);
+
+      for (auto &d : blockData)
+        vklRelease(d);
+    }
+
+    size_t numElements() const
+    {
+      return voxels.size();
+    }
+
+    size_t inputBytes() const
+    {
+      return bytes(voxels) + bytes(blockBounds) + bytes(blockLevels) +
+             bytes(cellWidths);
+    }
+
+    VKLVolume newVolume() const
+    {
+      VKLVolume volume = vklNewVolume("amr");
+      vklSetData(volume, "block.data", blockDataData);
+      vklSetData(volume, "block.bounds", blockBoundsData);
+      vklSetData(volume, "block.level", blockLevelData);
+      vklSetData(volume, "cellWidth", cellWidthData);
+      return volume;
+    }
+
+    std::vector<float> voxels;
+    std::vector<box3i> blockBounds;
+    std::vector<int> blockLevels;
+    std::vector<float> cellWidths;
+    std::vector<VKLData> blockData;
+
+    VKLData blockDataData{nullptr};
+    VKLData blockBoundsData{nullptr};
+    VKLData blockLevelData{nullptr};
+    VKLData cellWidthData{nullptr};
+  };
+
+  /*
+   * Dense VDB leaf nodes; the VDB levels are built on commit.
+   */
+  struct Vdb
+  {
+    static std::string name()
+    {
+      return "vdb";
+    }
+
+    explicit Vdb(size_t n)
+    {
+      const uint32_t leafLevel   = vklVdbNumLevels() - 1;
+      const int leafRes          = vklVdbLevelRes(leafLevel);
+      const size_t numLeafVoxels = vklVdbLevelNumVoxels(leafLevel);
+      const int numLeavesPerDim  = roundUp(cubeRoot(n), leafRes) / leafRes;
+
+      for (int x = 0; x < numLeavesPerDim; x++) {
+        for (int y = 0; y < numLeavesPerDim; y++) {
+          for (int z = 0; z < numLeavesPerDim; z++) {
+            levels.push_back(leafLevel);
+            origins.push_back(vec3i(x, y, z) * leafRes);
+            formats.push_back(VKL_FORMAT_CONSTANT_ZYX);
+          }
+        }
+      }
+
+      voxels.resize(origins.size() * numLeafVoxels);
+
+      rkcommon::tasking::parallel_for(origins.size(), [&](size_t l) {
+        float *leaf = voxels.data() + l * numLeafVoxels;
+
+        // leaf data is in z-y-x order, i.e. x is the slowest dimension
+        for (int x = 0; x < leafRes; x++) {
+          for (int y = 0; y < leafRes; y++) {
+            for (int z = 0; z < leafRes; z++) {
+              const vec3i p = origins[l] + vec3i(x, y, z);
+              leaf[(x * leafRes + y) * leafRes + z] = getWaveletValue<float>(
+                  vec3f(p) * (8.f / (numLeavesPerDim * leafRes)));
+            }
+          }
+        }
+      });
+
+      for (size_t l = 0; l < origins.size(); l++) {
+        leafData.push_back(vklNewData(numLeafVoxels,
+                                      VKL_FLOAT,
+                                      voxels.data() + l * numLeafVoxels,
+                                      VKL_DATA_SHARED_BUFFER));
+      }
+
+      levelData  = newSharedData(levels, VKL_UINT);
+      originData = newSharedData(origins, VKL_VEC3I);
+      formatData = newSharedData(formats, VKL_UINT);
+      nodeData   = newSharedData(leafData, VKL_DATA);
+    }
+
+    ~Vdb()
+    {
+      vklRelease(levelData);
+      vklRelease(originData);
+      vklRelease(formatData);
+      vklRelease(nodeData);
+
+      for (auto &d : leafData)
+        vklRelease(d);
+    }
+
+    size_t numElements() const
+    {
+      return voxels.size();
+    }
+
+    size_t inputBytes() const
+    {
+      return bytes(voxels) + bytes(levels) + bytes(origins) + bytes(formats);
+    }
+
+    VKLVolume newVolume() const
+    {
+      VKLVolume volume = vklNewVolume("vdb");
+      vklSetData(volume, "node.level", levelData);
+      vklSetData(volume, "node.origin", originData);
+      vklSetData(volume, "node.format", formatData);
+      vklSetData(volume, "node.data", nodeData);
+      return volume;
+    }
+
+    std::vector<float> voxels;
+    std::vector<uint32_t> levels;
+    std::vector<vec3i> origins;
+    std::vector<uint32_t> formats;
+    std::vector<VKLData> leafData;
+
+    VKLData levelData{nullptr};
+    VKLData originData{nullptr};
+    VKLData formatData{nullptr};
+    VKLData nodeData{nullptr};
+  };
+
+}  // namespace commit_fixture
+
+namespace api {
+
+  /*
+   * Measures vklCommit() on a new volume in every iteration. Only the commit
+   * itself is timed; data generation and setting parameters are not.
+   *
+   * Reported counters (all in bytes, except elements):
+   *
+   *   elements:     number of voxels, cells or particles
+   *   inputBytes:   size of the application-side input data
+   *   peakRSS:      peak resident set size of the process during the commits
+   *   commitBytes:  peakRSS minus the resident set size before the first
+   *                 commit, i.e. the memory consumed by the acceleration
+   *                 structure and any temporary build data
+   *   accelBytes:   accelerator memory reported by vklGetVolumeMemoryUsage()
+   *
+   * Peak RSS tracking is only reset between benchmarks on Linux; elsewhere,
+   * peakRSS is the peak since process start.
+   */
+  template <class Fixture>
+  struct VklCommit
+  {
+    static const std::string name()
+    {
+      return "commit<" + Fixture::name() + ">";
+    }
+
+    static inline void run(benchmark::State &state)
+    {
+      using Clock = std::chrono::steady_clock;
+
+      const Fixture fixture(static_cast<size_t>(state.range(0)));
+
+      const size_t rssBefore = memory::currentRSS();
+      memory::resetPeakRSS();
+
+      size_t accelBytes = 0;
+
+      for (auto _ : state) {
+        VKLVolume volume = fixture.newVolume();
+
+        const auto start = Clock::now();
+        vklCommit(volume);
+        const auto end = Clock::now();
+
+        state.SetIterationTime(
+            std::chrono::duration<double>(end - start).count());
+
+        accelBytes = vklGetVolumeMemoryUsage(volume).accelerator;
+
+        vklRelease(volume);
+      }
+
+      const size_t peakRSS = memory::peakRSS();
+
+      // enables rates (elements built per second) in report output
+      state.SetItemsProcessed(state.iterations() * fixture.numElements());
+
+      using benchmark::Counter;
+
+      state.counters["elements"] = Counter(fixture.numElements());
+      state.counters["inputBytes"] = Counter(
+          fixture.inputBytes(), Counter::kDefaults, Counter::OneK::kIs1024);
+      state.counters["peakRSS"] =
+          Counter(peakRSS, Counter::kDefaults, Counter::OneK::kIs1024);
+      state.counters["commitBytes"] =
+          Counter(peakRSS > rssBefore ? peakRSS - rssBefore : 0,
+                  Counter::kDefaults,
+                  Counter::OneK::kIs1024);
+      state.counters["accelBytes"] =
+          Counter(accelBytes, Counter::kDefaults, Counter::OneK::kIs1024);
+    }
+  };
+
+}  // namespace api
+
+/*
+ * The largest number of elements for commit benchmarks. Defaults to 64M,
+ * and can be raised (e.g. to 1073741824) with the
+ * OPENVKL_BENCHMARK_COMMIT_MAX_ELEMENTS environment variable.
+ */
+inline int64_t maxCommitElements()
+{
+  const char *env = std::getenv("OPENVKL_BENCHMARK_COMMIT_MAX_ELEMENTS");
+  if (env && std::atoll(env) > 0)
+    return std::atoll(env);
+
+  return int64_t(1) << 26;
+}
+
+/*
+ * Register commit benchmarks for the given fixture, from 1M elements up to
+ * maxCommitElements().
+ */
+template <class Fixture>
+inline void registerCommit()
+{
+  registerBenchmark<api::VklCommit<Fixture>>()
+      ->RangeMultiplier(8)
+      ->Range(int64_t(1) << 20,
+              std::max(int64_t(1) << 20, maxCommitElements()))
+      ->UseManualTime()
+      ->Unit(benchmark::kMillisecond);
+}
+
+/*
+ * Register commit benchmarks for all volume types.
+ */
+inline void registerCommitBenchmarks()
+{
+  using namespace commit_fixture;
+
+  registerCommit<Structured<false>>();
+  registerCommit<Structured<true>>();
+  registerCommit<Unstructured>();
+  registerCommit<Particle>();
+  registerCommit<AMR>();
+  registerCommit<Vdb>();
+}
@@ -34,12 +34,14 @@ namespace api {
 
     static inline void run(benchmark::State &state)
     {
-      VolumeWrapper wrapper;
-      VKLSampler sampler = wrapper.getSampler();
-      CoordinateGenerator gen(vklGetBoundingBox(wrapper.getVolume()));
+      SharedVolume<VolumeWrapper> wrapper;
+      VKLSampler sampler = wrapper->getSampler();
+      CoordinateGenerator gen(vklGetBoundingBox(wrapper->getVolume()));
+      ScalingCounters<VklComputeGradient> scaling;
       vkl_vec3f objectCoordinates{0.f, 0.f, 0.f};
 
       for (auto _ : state) {
+        scaling.iteration();
         gen.template getNextN<1>(&objectCoordinates);
         benchmark::DoNotOptimize(
             vklComputeGradient(sampler, &objectCoordinates));
@@ -47,6 +49,44 @@ namespace api {
 
       // enables rates in report output
       state.SetItemsProcessed(state.iterations());
+      scaling.finish(state, 1);
+    }
+  };
+
+  template <class VolumeWrapper, class CoordinateGenerator>
+  struct VklComputeGradient<programming_model::ScalarDirect,
+                            VolumeWrapper,
+                            CoordinateGenerator>
+  {
+    static const std::string name()
+    {
+      std::ostringstream os;
+      os << "scalarDirect" << CoordinateGenerator::name() << "Gradient";
+      if (!VolumeWrapper::name().empty())
+         os << "<" << VolumeWrapper::name() << ">";
+      return os.str();
+    }
+
+    static inline void run(benchmark::State &state)
+    {
+      SharedVolume<VolumeWrapper> wrapper;
+      VKLSampler sampler = wrapper->getSampler();
+      CoordinateGenerator gen(vklGetBoundingBox(wrapper->getVolume()));
+      ScalingCounters<VklComputeGradient> scaling;
+      vkl_vec3f objectCoordinates{0.f, 0.f, 0.f};
+
+      const VKLSamplerFunctions functions = vklGetSamplerFunctions(sampler);
+
+      for (auto _ : state) {
+        scaling.iteration();
+        gen.template getNextN<1>(&objectCoordinates);
+        benchmark::DoNotOptimize(
+            functions.computeGradient(sampler, &objectCoordinates));
+      }
+
+      // enables rates in report output
+      state.SetItemsProcessed(state.iterations());
+      scaling.finish(state, 1);
     }
   };
 
@@ -120,9 +160,10 @@ namespace api {
 
     static inline void run(benchmark::State &state)
     {
-      VolumeWrapper wrapper;
-      VKLSampler sampler = wrapper.getSampler();
-      CoordinateGenerator gen(vklGetBoundingBox(wrapper.getVolume()));
+      SharedVolume<VolumeWrapper> wrapper;
+      VKLSampler sampler = wrapper->getSampler();
+      CoordinateGenerator gen(vklGetBoundingBox(wrapper->getVolume()));
+      ScalingCounters<VklComputeGradient> scaling;
 
       vintn<W> valid;
       vvec3fn<W> objectCoordinates;
@@ -133,6 +174,7 @@ namespace api {
       }
 
       for (auto _ : state) {
+        scaling.iteration();
         gen.template getNextV<W>(&objectCoordinates);
         impl::VklComputeGradient<W, VolumeWrapper, CoordinateGenerator>::call(
             valid, sampler, objectCoordinates, samples);
@@ -140,6 +182,7 @@ namespace api {
 
       // enables rates in report output
       state.SetItemsProcessed(state.iterations() * W);
+      scaling.finish(state, W);
     }
   };
 
@@ -161,14 +204,16 @@ namespace api {
 
     static inline void run(benchmark::State &state)
     {
-      VolumeWrapper wrapper;
-      VKLSampler sampler = wrapper.getSampler();
-      CoordinateGenerator gen(vklGetBoundingBox(wrapper.getVolume()));
+      SharedVolume<VolumeWrapper> wrapper;
+      VKLSampler sampler = wrapper->getSampler();
+      CoordinateGenerator gen(vklGetBoundingBox(wrapper->getVolume()));
+      ScalingCounters<VklComputeGradient> scaling;
 
       std::vector<vkl_vec3f> objectCoordinates(N);
       std::vector<vkl_vec3f> samples(N);
 
       for (auto _ : state) {
+        scaling.iteration();
         gen.template getNextN<N>(objectCoordinates.data());
         vklComputeGradientN(
             sampler, N, objectCoordinates.data(), samples.data());
@@ -176,6 +221,7 @@ namespace api {
 
       // enables rates in report output
       state.SetItemsProcessed(state.iterations() * N);
+      scaling.finish(state, N);
     }
   };
 
@@ -188,11 +234,15 @@ template <class VolumeWrapper, class CoordinateGenerator>
 inline void registerComputeGradient()
 {
   using programming_model::Scalar;
+  using programming_model::ScalarDirect;
   using programming_model::Stream;
   using programming_model::Vector;
 
   registerBenchmark<
       api::VklComputeGradient<Scalar, VolumeWrapper, CoordinateGenerator>>();
+  registerBenchmark<api::VklComputeGradient<ScalarDirect,
+                                            VolumeWrapper,
+                                            CoordinateGenerator>>();
 
   registerBenchmark<
       api::VklComputeGradient<Vector<4>, VolumeWrapper, CoordinateGenerator>>();
@@ -223,5 +273,33 @@ inline void registerComputeGradient()
   registerBenchmark<api::VklComputeGradient<Stream<256>,
                                             VolumeWrapper,
                                             CoordinateGenerator>>();
+
+  // thread count sweeps for scaling analysis
+  registerThreadSweep<
+      api::VklComputeGradient<Scalar, VolumeWrapper, CoordinateGenerator>>();
+
+  switch (vklGetNativeSIMDWidth()) {
+  case 4:
+    registerThreadSweep<api::VklComputeGradient<Vector<4>,
+                                                VolumeWrapper,
+                                                CoordinateGenerator>>();
+    break;
+  case 8:
+    registerThreadSweep<api::VklComputeGradient<Vector<8>,
+                                                VolumeWrapper,
+                                                CoordinateGenerator>>();
+    break;
+  case 16:
+    registerThreadSweep<api::VklComputeGradient<Vector<16>,
+                                                VolumeWrapper,
+                                                CoordinateGenerator>>();
+    break;
+  default:
+    break;
+  }
+
+  registerThreadSweep<api::VklComputeGradient<Stream<64>,
+                                              VolumeWrapper,
+                                              CoordinateGenerator>>();
 }
 
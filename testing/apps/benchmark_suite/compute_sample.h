@@ -35,19 +35,59 @@ namespace api {
 
     static inline void run(benchmark::State &state)
     {
-      VolumeWrapper wrapper;
-      VKLSampler sampler = wrapper.getSampler();
-      CoordinateGenerator gen(vklGetBoundingBox(wrapper.getVolume()));
+      SharedVolume<VolumeWrapper> wrapper;
+      VKLSampler sampler = wrapper->getSampler();
+      CoordinateGenerator gen(vklGetBoundingBox(wrapper->getVolume()));
+      ScalingCounters<VklComputeSample> scaling;
 
       vkl_vec3f objectCoordinates{0.f, 0.f, 0.f};
 
       for (auto _ : state) {
+        scaling.iteration();
         gen.template getNextN<1>(&objectCoordinates);
         benchmark::DoNotOptimize(vklComputeSample(sampler, &objectCoordinates));
       }
 
       // enables rates in report output
       state.SetItemsProcessed(state.iterations());
+      scaling.finish(state, 1);
+    }
+  };
+
+  template <class VolumeWrapper, class CoordinateGenerator>
+  struct VklComputeSample<programming_model::ScalarDirect,
+                          VolumeWrapper,
+                          CoordinateGenerator>
+  {
+    static const std::string name()
+    {
+      std::ostringstream os;
+      os << "scalarDirect" << CoordinateGenerator::name() << "Sample";
+      if (!VolumeWrapper::name().empty())
+         os << "<" << VolumeWrapper::name() << ">";
+      return os.str();
+    }
+
+    static inline void run(benchmark::State &state)
+    {
+      SharedVolume<VolumeWrapper> wrapper;
+      VKLSampler sampler = wrapper->getSampler();
+      CoordinateGenerator gen(vklGetBoundingBox(wrapper->getVolume()));
+      ScalingCounters<VklComputeSample> scaling;
+      vkl_vec3f objectCoordinates{0.f, 0.f, 0.f};
+
+      const VKLSamplerFunctions functions = vklGetSamplerFunctions(sampler);
+
+      for (auto _ : state) {
+        scaling.iteration();
+        gen.template getNextN<1>(&objectCoordinates);
+        benchmark::DoNotOptimize(
+            functions.computeSample(sampler, &objectCoordinates));
+      }
+
+      // enables rates in report output
+      state.SetItemsProcessed(state.iterations());
+      scaling.finish(state, 1);
     }
   };
 
@@ -119,9 +159,10 @@ namespace api {
 
     static inline void run(benchmark::State &state)
     {
-      VolumeWrapper wrapper;
-      VKLSampler sampler = wrapper.getSampler();
-      CoordinateGenerator gen(vklGetBoundingBox(wrapper.getVolume()));
+      SharedVolume<VolumeWrapper> wrapper;
+      VKLSampler sampler = wrapper->getSampler();
+      CoordinateGenerator gen(vklGetBoundingBox(wrapper->getVolume()));
+      ScalingCounters<VklComputeSample> scaling;
 
       vintn<W> valid;
       vvec3fn<W> objectCoordinates;
@@ -132,6 +173,7 @@ namespace api {
       }
 
       for (auto _ : state) {
+        scaling.iteration();
         gen.template getNextV<W>(&objectCoordinates);
         impl::VklComputeSample<W, VolumeWrapper, CoordinateGenerator>::call(
             valid, sampler, objectCoordinates, samples);
@@ -139,6 +181,7 @@ namespace api {
 
       // enables rates in report output
       state.SetItemsProcessed(state.iterations() * W);
+      scaling.finish(state, W);
     }
   };
 
@@ -160,20 +203,23 @@ namespace api {
 
     static inline void run(benchmark::State &state)
     {
-      VolumeWrapper wrapper;
-      VKLSampler sampler = wrapper.getSampler();
-      CoordinateGenerator gen(vklGetBoundingBox(wrapper.getVolume()));
+      SharedVolume<VolumeWrapper> wrapper;
+      VKLSampler sampler = wrapper->getSampler();
+      CoordinateGenerator gen(vklGetBoundingBox(wrapper->getVolume()));
+      ScalingCounters<VklComputeSample> scaling;
 
       std::vector<vkl_vec3f> objectCoordinates(N);
       std::vector<float> samples(N);
 
       for (auto _ : state) {
+        scaling.iteration();
         gen.template getNextN<N>(objectCoordinates.data());
         vklComputeSampleN(sampler, N, objectCoordinates.data(), samples.data());
       }
 
       // enables rates in report output
       state.SetItemsProcessed(state.iterations() * N);
+      scaling.finish(state, N);
     }
   };
 
@@ -186,11 +232,15 @@ template <class VolumeWrapper, class CoordinateGenerator>
 inline void registerComputeSample()
 {
   using programming_model::Scalar;
+  using programming_model::ScalarDirect;
   using programming_model::Stream;
   using programming_model::Vector;
 
   registerBenchmark<
       api::VklComputeSample<Scalar, VolumeWrapper, CoordinateGenerator>>();
+  registerBenchmark<api::VklComputeSample<ScalarDirect,
+                                          VolumeWrapper,
+                                          CoordinateGenerator>>();
 
   registerBenchmark<
       api::VklComputeSample<Vector<4>, VolumeWrapper, CoordinateGenerator>>();
@@ -215,5 +265,30 @@ inline void registerComputeSample()
       api::VklComputeSample<Stream<128>, VolumeWrapper, CoordinateGenerator>>();
   registerBenchmark<
       api::VklComputeSample<Stream<256>, VolumeWrapper, CoordinateGenerator>>();
+
+  // thread count sweeps for scaling analysis
+  registerThreadSweep<
+      api::VklComputeSample<Scalar, VolumeWrapper, CoordinateGenerator>>();
+
+  switch (vklGetNativeSIMDWidth()) {
+  case 4:
+    registerThreadSweep<
+        api::VklComputeSample<Vector<4>, VolumeWrapper, CoordinateGenerator>>();
+    break;
+  case 8:
+    registerThreadSweep<
+        api::VklComputeSample<Vector<8>, VolumeWrapper, CoordinateGenerator>>();
+    break;
+  case 16:
+    registerThreadSweep<api::VklComputeSample<Vector<16>,
+                                              VolumeWrapper,
+                                              CoordinateGenerator>>();
+    break;
+  default:
+    break;
+  }
+
+  registerThreadSweep<
+      api::VklComputeSample<Stream<64>, VolumeWrapper, CoordinateGenerator>>();
 }
 
@@ -52,7 +52,10 @@ namespace api {
         buffers.resize(intervalIteratorSize * state.threads);
       }
 
+      ScalingCounters<IntervalIteratorConstruction> scaling;
+
       for (auto _ : state) {
+        scaling.iteration();
         void *buffer = buffers.data() + intervalIteratorSize * state.thread_index;
         VKLIntervalIterator iterator = vklInitIntervalIterator(
             vklVolume, &origin, &direction, &tRange, nullptr, buffer);
@@ -65,6 +68,7 @@ namespace api {
 
       // enables rates in report output
       state.SetItemsProcessed(state.iterations());
+      scaling.finish(state, 1);
     }
   };
 
@@ -113,7 +117,10 @@ namespace api {
       VKLInterval interval;
       std::vector<char> buffer;
 
+      ScalingCounters<IntervalIteratorIterateFirst> scaling;
+
       for (auto _ : state) {
+        scaling.iteration();
         void *buffer = buffers.data() + intervalIteratorSize * state.thread_index;
         VKLIntervalIterator iterator = vklInitIntervalIterator(
             vklVolume, &origin, &direction, &tRange, nullptr, buffer);
@@ -133,6 +140,7 @@ namespace api {
 
       // enables rates in report output
       state.SetItemsProcessed(state.iterations());
+      scaling.finish(state, 1);
     }
   };
 
@@ -176,7 +184,11 @@ namespace api {
       }
 
       VKLInterval interval;
+
+      ScalingCounters<IntervalIteratorIterateSecond> scaling;
+
       for (auto _ : state) {
+        scaling.iteration();
         void *buffer = buffers.data() + intervalIteratorSize * state.thread_index;
         VKLIntervalIterator iterator = vklInitIntervalIterator(
             vklVolume, &origin, &direction, &tRange, nullptr, buffer);
@@ -197,6 +209,78 @@ namespace api {
 
       // enables rates in report output
       state.SetItemsProcessed(state.iterations());
+      scaling.finish(state, 1);
+    }
+  };
+
+  /*
+   * Iterates all intervals along a ray. Scalar iteration dominates here,
+   * which makes this a good measure for the uniform iterator code paths.
+   */
+  template <class VolumeWrapper>
+  struct IntervalIteratorIterateAll
+  {
+    static const std::string name()
+    {
+      std::ostringstream os;
+      os << "scalarIntervalIteratorIterateAll";
+      if (!VolumeWrapper::name().empty())
+        os << "<" << VolumeWrapper::name() << ">";
+      return os.str();
+    }
+
+    static inline void run(benchmark::State &state)
+    {
+      static std::unique_ptr<VolumeWrapper> wrapper;
+      static VKLVolume vklVolume;
+      static vkl_vec3f origin;
+      static const vkl_vec3f direction{0.f, 0.f, 1.f};
+      static const vkl_range1f tRange{0.f, 1000.f};
+      static size_t intervalIteratorSize { 0 };
+      static std::vector<char> buffers;
+
+      if (state.thread_index == 0)
+      {
+        wrapper = rkcommon::make_unique<VolumeWrapper>();
+        vklVolume            = wrapper->getVolume();
+        const vkl_box3f bbox = vklGetBoundingBox(vklVolume);
+
+        std::uniform_real_distribution<float> distX(bbox.lower.x, bbox.upper.x);
+        std::uniform_real_distribution<float> distY(bbox.lower.y, bbox.upper.y);
+
+        std::random_device rd;
+        std::mt19937 eng(rd());
+        origin = vkl_vec3f{distX(eng), distY(eng), -1.f};
+
+        intervalIteratorSize = vklGetIntervalIteratorSize(vklVolume);
+        buffers.resize(intervalIteratorSize * state.threads);
+      }
+
+      VKLInterval interval;
+      size_t numIntervals = 0;
+
+      ScalingCounters<IntervalIteratorIterateAll> scaling;
+
+      for (auto _ : state) {
+        scaling.iteration();
+        void *buffer = buffers.data() + intervalIteratorSize * state.thread_index;
+        VKLIntervalIterator iterator = vklInitIntervalIterator(
+            vklVolume, &origin, &direction, &tRange, nullptr, buffer);
+
+        while (vklIterateInterval(iterator, &interval)) {
+          benchmark::DoNotOptimize(interval);
+          numIntervals++;
+        }
+      }
+
+      if (state.thread_index == 0)
+        wrapper.reset();
+
+      // enables rates in report output
+      state.SetItemsProcessed(state.iterations());
+      scaling.finish(state, 1);
+      state.counters["intervals"] = benchmark::Counter(
+          numIntervals, benchmark::Counter::kAvgIterations);
     }
   };
 
@@ -209,30 +293,14 @@ template <class VolumeWrapper>
 inline void registerIntervalIterators()
 {
   using Construction = api::IntervalIteratorConstruction<VolumeWrapper>;
-  registerBenchmark<Construction>()->UseRealTime();
-  registerBenchmark<Construction>()->Threads(2)->UseRealTime();
-  registerBenchmark<Construction>()->Threads(4)->UseRealTime();
-  registerBenchmark<Construction>()->Threads(6)->UseRealTime();
-  registerBenchmark<Construction>()->Threads(12)->UseRealTime();
-  registerBenchmark<Construction>()->Threads(36)->UseRealTime();
-  registerBenchmark<Construction>()->Threads(72)->UseRealTime();
+  registerThreadSweep<Construction>();
 
   using IterateFirst = api::IntervalIteratorIterateFirst<VolumeWrapper>;
-  registerBenchmark<IterateFirst>()->UseRealTime();
-  registerBenchmark<IterateFirst>()->Threads(2)->UseRealTime();
-  registerBenchmark<IterateFirst>()->Threads(4)->UseRealTime();
-  registerBenchmark<IterateFirst>()->Threads(6)->UseRealTime();
-  registerBenchmark<IterateFirst>()->Threads(12)->UseRealTime();
-  registerBenchmark<IterateFirst>()->Threads(36)->UseRealTime();
-  registerBenchmark<IterateFirst>()->Threads(72)->UseRealTime();
+  registerThreadSweep<IterateFirst>();
 
   using IterateSecond = api::IntervalIteratorIterateSecond<VolumeWrapper>;
-  registerBenchmark<IterateSecond>()->UseRealTime();
-  registerBenchmark<IterateSecond>()->Threads(2)->UseRealTime();
-  registerBenchmark<IterateSecond>()->Threads(4)->UseRealTime();
-  registerBenchmark<IterateSecond>()->Threads(6)->UseRealTime();
-  registerBenchmark<IterateSecond>()->Threads(12)->UseRealTime();
-  registerBenchmark<IterateSecond>()->Threads(36)->UseRealTime();
-  registerBenchmark<IterateSecond>()->Threads(72)->UseRealTime();
-}
+  registerThreadSweep<IterateSecond>();
 
+  using IterateAll = api::IntervalIteratorIterateAll<VolumeWrapper>;
+  registerThreadSweep<IterateAll>();
+}
@@ -0,0 +1,127 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+// windows.h must come first
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <sys/resource.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Process memory queries for the benchmarking suite.
+ *
+ * All values are in bytes. Queries that are not supported on the current
+ * platform return 0.
+ */
+namespace memory {
+
+  /*
+   * The current resident set size of this process.
+   */
+  inline size_t currentRSS()
+  {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+      return counters.WorkingSetSize;
+    return 0;
+#elif defined(__APPLE__)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(),
+                  MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info),
+                  &count) == KERN_SUCCESS)
+      return info.resident_size;
+    return 0;
+#else
+    FILE *file = std::fopen("/proc/self/statm", "r");
+    if (!file)
+      return 0;
+
+    long pages    = 0;
+    long resident = 0;
+    const int n   = std::fscanf(file, "%ld %ld", &pages, &resident);
+    std::fclose(file);
+
+    if (n != 2)
+      return 0;
+
+    return static_cast<size_t>(resident) * sysconf(_SC_PAGESIZE);
+#endif
+  }
+
+  /*
+   * The peak resident set size of this process, since process start or the
+   * last successful resetPeakRSS().
+   */
+  inline size_t peakRSS()
+  {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+      return counters.PeakWorkingSetSize;
+    return 0;
+#else
+#if defined(__linux__)
+    // VmHWM is the value affected by resetPeakRSS()
+    FILE *file = std::fopen("/proc/self/status", "r");
+    if (file) {
+      char line[256];
+      long kilobytes = -1;
+
+      while (std::fgets(line, sizeof(line), file)) {
+        if (std::sscanf(line, "VmHWM: %ld kB", &kilobytes) == 1)
+          break;
+      }
+      std::fclose(file);
+
+      if (kilobytes >= 0)
+        return static_cast<size_t>(kilobytes) * 1024;
+    }
+#endif
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+      return 0;
+#if defined(__APPLE__)
+    // bytes on macOS
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    // kilobytes on Linux
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+  }
+
+  /*
+   * Reset the peak resident set size to the current resident set size.
+   * Returns false if this is not supported, in which case peakRSS() keeps
+   * reporting the peak since process start.
+   */
+  inline bool resetPeakRSS()
+  {
+#if defined(__linux__)
+    // supported since Linux 4.0
+    FILE *file = std::fopen("/proc/self/clear_refs", "w");
+    if (!file)
+      return false;
+
+    const bool success = std::fputs("5", file) >= 0;
+    return (std::fclose(file) == 0) && success;
+#else
+    return false;
+#endif
+  }
+
+}  // namespace memory
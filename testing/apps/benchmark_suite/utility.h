@@ -3,7 +3,12 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
 #include <random>
+#include <thread>
 #include "../common/simd.h"
 #include "openvkl_testing.h"
 #include "rkcommon/utility/random.h"
@@ -22,6 +27,11 @@ namespace programming_model {
   {
   };
 
+  // scalar calls through the function table from vklGetSamplerFunctions()
+  struct ScalarDirect
+  {
+  };
+
   template <int W>
   struct Vector
   {
@@ -146,3 +156,151 @@ inline benchmark::internal::Benchmark *registerBenchmark()
   return benchmark::RegisterBenchmark(Api::name().c_str(), Api::run);
 }
 
+
+/*
+ * Shares a single VolumeWrapper between all threads of a benchmark run.
+ *
+ * The first thread to construct a SharedVolume creates the wrapper, and the
+ * last thread to destroy its SharedVolume releases it again. All threads
+ * construct their SharedVolume before entering the benchmark loop, which
+ * Google benchmark does not start until all threads have arrived.
+ */
+template <class VolumeWrapper>
+class SharedVolume
+{
+ public:
+  SharedVolume()
+  {
+    std::lock_guard<std::mutex> lock(mutex());
+    if (numUsers()++ == 0)
+      instance() = rkcommon::make_unique<VolumeWrapper>();
+    wrapper = instance().get();
+  }
+
+  ~SharedVolume()
+  {
+    std::lock_guard<std::mutex> lock(mutex());
+    if (--numUsers() == 0)
+      instance().reset();
+  }
+
+  SharedVolume(const SharedVolume &) = delete;
+  SharedVolume &operator=(const SharedVolume &) = delete;
+
+  const VolumeWrapper *operator->() const
+  {
+    return wrapper;
+  }
+
+ private:
+  static std::mutex &mutex()
+  {
+    static std::mutex m;
+    return m;
+  }
+
+  static size_t &numUsers()
+  {
+    static size_t n{0};
+    return n;
+  }
+
+  static std::unique_ptr<VolumeWrapper> &instance()
+  {
+    static std::unique_ptr<VolumeWrapper> w;
+    return w;
+  }
+
+  const VolumeWrapper *wrapper{nullptr};
+};
+
+/*
+ * Per-thread scaling counters for multi-threaded benchmarks.
+ *
+ * Each thread times its own benchmark loop, starting with the first
+ * iteration so that setup in other threads is not counted. finish() adds
+ *
+ *   itemsPerThread:      items per second, averaged over all threads
+ *   parallelEfficiency:  itemsPerThread relative to the most recent
+ *                        single-threaded run of the same Api
+ *
+ * to the report. Both appear in machine-readable output, e.g. with
+ * --benchmark_format=json or --benchmark_out=<file>.
+ */
+template <class Api>
+class ScalingCounters
+{
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  // call at the top of every iteration of the benchmark loop
+  inline void iteration()
+  {
+    if (!started) {
+      start   = Clock::now();
+      started = true;
+    }
+  }
+
+  // call once after the benchmark loop
+  void finish(benchmark::State &state, int64_t itemsPerIteration)
+  {
+    const double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+
+    if (!started || seconds <= 0.0)
+      return;
+
+    const double rate = state.iterations() * itemsPerIteration / seconds;
+
+    // single-threaded runs are always registered first, so this is only
+    // written while no other thread of the same Api is running
+    if (state.threads == 1)
+      singleThreadRate() = rate;
+
+    state.counters["itemsPerThread"] =
+        benchmark::Counter(rate, benchmark::Counter::kAvgThreads);
+
+    if (singleThreadRate() > 0.0) {
+      state.counters["parallelEfficiency"] = benchmark::Counter(
+          rate / singleThreadRate(), benchmark::Counter::kAvgThreads);
+    }
+  }
+
+ private:
+  static double &singleThreadRate()
+  {
+    static double r{0.0};
+    return r;
+  }
+
+  bool started{false};
+  Clock::time_point start;
+};
+
+/*
+ * The maximum number of threads for thread count sweeps. Defaults to the
+ * number of hardware threads, and can be overridden with the
+ * OPENVKL_BENCHMARK_MAX_THREADS environment variable.
+ */
+inline int maxBenchmarkThreads()
+{
+  const char *env = std::getenv("OPENVKL_BENCHMARK_MAX_THREADS");
+  if (env && std::atoi(env) > 0)
+    return std::atoi(env);
+
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+/*
+ * Registers the given Api with thread counts 1, 2, 4, ... up to
+ * maxBenchmarkThreads(). The Api must use SharedVolume (or equivalent) and
+ * ScalingCounters.
+ */
+template <class Api>
+inline benchmark::internal::Benchmark *registerThreadSweep()
+{
+  return registerBenchmark<Api>()
+      ->ThreadRange(1, maxBenchmarkThreads())
+      ->UseRealTime();
+}
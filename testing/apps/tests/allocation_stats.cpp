@@ -0,0 +1,90 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <vector>
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+
+using namespace rkcommon;
+using namespace openvkl::testing;
+
+static void setHugePages(const char *mode)
+{
+  VKLDriver driver = vklNewDriver("ispc");
+  vklDriverSetString(driver, "hugePages", mode);
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+}
+
+TEST_CASE("Allocation statistics", "[allocation_stats]")
+{
+  vklLoadModule("ispc_driver");
+
+  const std::vector<std::string> modes{"none", "transparent", "explicit"};
+
+  for (const auto &mode : modes) {
+    DYNAMIC_SECTION("hugePages " << mode)
+    {
+      setHugePages(mode.c_str());
+
+      const VKLAllocationStats before =
+          vklGetAllocationStats(VKL_ALLOCATION_DATA);
+
+      // 8 MB, large enough for huge pages
+      const size_t numItems = size_t(1) << 21;
+      std::vector<float> values(numItems, 1.f);
+
+      VKLData data = vklNewData(numItems, VKL_FLOAT, values.data());
+
+      const VKLAllocationStats during =
+          vklGetAllocationStats(VKL_ALLOCATION_DATA);
+
+      REQUIRE(during.numBuffers == before.numBuffers + 1);
+      REQUIRE(during.bytes >= before.bytes + numItems * sizeof(float));
+      REQUIRE(during.numHugePageBuffers <= during.numBuffers);
+      REQUIRE(during.hugePageBytes <= during.bytes);
+
+      // huge pages may be unavailable, but are never used unless requested
+      if (mode == "none") {
+        REQUIRE(during.numHugePageBuffers == before.numHugePageBuffers);
+      }
+
+      // shared buffers are not allocated by Open VKL
+      VKLData shared = vklNewData(
+          numItems, VKL_FLOAT, values.data(), VKL_DATA_SHARED_BUFFER);
+      REQUIRE(vklGetAllocationStats(VKL_ALLOCATION_DATA).numBuffers ==
+              during.numBuffers);
+
+      vklRelease(shared);
+      vklRelease(data);
+
+      const VKLAllocationStats after =
+          vklGetAllocationStats(VKL_ALLOCATION_DATA);
+
+      REQUIRE(after.numBuffers == before.numBuffers);
+      REQUIRE(after.bytes == before.bytes);
+      REQUIRE(after.numHugePageBuffers == before.numHugePageBuffers);
+      REQUIRE(after.hugePageBytes == before.hugePageBytes);
+
+      // structured volume macro cell grids
+      {
+        WaveletStructuredRegularVolume<float> volume(
+            vec3i(128), vec3f(0.f), vec3f(1.f));
+
+        REQUIRE(volume.getVKLVolume() != nullptr);
+        REQUIRE(vklGetAllocationStats(VKL_ALLOCATION_ACCELERATOR).bytes > 0);
+      }
+    }
+  }
+
+  SECTION("invalid category")
+  {
+    const VKLAllocationStats stats =
+        vklGetAllocationStats(VKL_ALLOCATION_NUM_CATEGORIES);
+    REQUIRE(stats.numBuffers == 0);
+    REQUIRE(stats.bytes == 0);
+  }
+
+  // restore the default for subsequent tests
+  setHugePages("none");
+}
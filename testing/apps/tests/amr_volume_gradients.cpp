@@ -0,0 +1,159 @@
+// Copyright 2019-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+#include "rkcommon/utility/multidim_index_sequence.h"
+
+using namespace rkcommon;
+using namespace openvkl::testing;
+
+// a two level AMR volume whose values are a linear function of the cell
+// centers, so that every brick has a non-zero gradient: a single coarse block
+// covers [0, 64)^3, and two fine blocks refine [16, 48) x [16, 32) x [16, 32)
+VKLVolume newLinearAMRVolume(const vec3f &valueGradient)
+{
+  const int blockSize = 16;
+
+  const std::vector<float> cellWidths{4.f, 1.f};
+  const std::vector<int> refinementLevels{0, 1, 1};
+
+  // block bound upper bounds are inclusive, hence subtracting 1
+  const std::vector<box3i> blockBounds{
+      box3i(vec3i(0), vec3i(blockSize - 1)),
+      box3i(vec3i(16), vec3i(16 + blockSize - 1)),
+      box3i(vec3i(32, 16, 16), vec3i(32 + blockSize - 1, 31, 31))};
+
+  std::vector<VKLData> blockData;
+
+  for (size_t b = 0; b < blockBounds.size(); b++) {
+    const float cellWidth = cellWidths[refinementLevels[b]];
+
+    std::vector<float> voxels;
+
+    multidim_index_sequence<3> mis(blockBounds[b].size() + 1);
+
+    for (const auto &index : mis) {
+      const vec3f cellCenter =
+          (vec3f(blockBounds[b].lower + index) + 0.5f) * cellWidth;
+      voxels.push_back(dot(valueGradient, cellCenter));
+    }
+
+    blockData.push_back(vklNewData(voxels.size(), VKL_FLOAT, voxels.data()));
+  }
+
+  VKLData blockDataData =
+      vklNewData(blockData.size(), VKL_DATA, blockData.data());
+  VKLData blockBoundsData =
+      vklNewData(blockBounds.size(), VKL_BOX3I, blockBounds.data());
+  VKLData refinementLevelsData =
+      vklNewData(refinementLevels.size(), VKL_INT, refinementLevels.data());
+  VKLData cellWidthsData =
+      vklNewData(cellWidths.size(), VKL_FLOAT, cellWidths.data());
+
+  VKLVolume volume = vklNewVolume("amr");
+
+  vklSetData(volume, "block.data", blockDataData);
+  vklSetData(volume, "block.bounds", blockBoundsData);
+  vklSetData(volume, "block.level", refinementLevelsData);
+  vklSetData(volume, "cellWidth", cellWidthsData);
+
+  vklRelease(blockDataData);
+  vklRelease(blockBoundsData);
+  vklRelease(refinementLevelsData);
+  vklRelease(cellWidthsData);
+
+  for (auto &d : blockData)
+    vklRelease(d);
+
+  return volume;
+}
+
+void amr_gradients_vs_central_differences(VKLAMRMethod method)
+{
+  const vec3i dimensions(64);
+  const vec3f valueGradient(0.1f, 0.2f, 0.3f);
+
+  VKLVolume vklVolume = newLinearAMRVolume(valueGradient);
+
+  vklSetInt(vklVolume, "method", method);
+  vklCommit(vklVolume);
+
+  VKLSampler vklSampler = vklNewSampler(vklVolume);
+  vklCommit(vklSampler);
+
+  // the interpolant is trilinear within each dual cell (or octant), so central
+  // differences along an axis are exact as long as they do not straddle a
+  // cell center or face. sample positions are offset from both.
+  const float h = 0.01f;
+
+  multidim_index_sequence<3> mis(dimensions / 7);
+
+  // guards against a trivially passing test on a (locally) constant field
+  size_t numNonZeroGradients = 0;
+
+  for (const auto &index : mis) {
+    const vec3f objectCoordinates = vec3f(index * 7) + vec3f(1.3f);
+
+    INFO("method = " << method);
+    INFO("objectCoordinates = " << objectCoordinates.x << " "
+                                << objectCoordinates.y << " "
+                                << objectCoordinates.z);
+
+    const vkl_vec3f vklGradient =
+        vklComputeGradient(vklSampler, (const vkl_vec3f *)&objectCoordinates);
+    const vec3f gradient = (const vec3f &)vklGradient;
+
+    vec3f centralDifferences;
+
+    for (int d = 0; d < 3; d++) {
+      vec3f offset(0.f);
+      offset[d] = h;
+
+      const vec3f p0 = objectCoordinates - offset;
+      const vec3f p1 = objectCoordinates + offset;
+
+      centralDifferences[d] =
+          (vklComputeSample(vklSampler, (const vkl_vec3f *)&p1) -
+           vklComputeSample(vklSampler, (const vkl_vec3f *)&p0)) /
+          (2.f * h);
+    }
+
+    REQUIRE(gradient.x == Approx(centralDifferences.x).margin(1e-2f));
+    REQUIRE(gradient.y == Approx(centralDifferences.y).margin(1e-2f));
+    REQUIRE(gradient.z == Approx(centralDifferences.z).margin(1e-2f));
+
+    if (length(gradient) > 0.1f * length(valueGradient)) {
+      numNonZeroGradients++;
+    }
+  }
+
+  REQUIRE(numNonZeroGradients >= mis.total_indices() / 2);
+
+  vklRelease(vklSampler);
+  vklRelease(vklVolume);
+}
+
+TEST_CASE("AMR volume gradients", "[volume_gradients]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  SECTION("current method")
+  {
+    amr_gradients_vs_central_differences(VKL_AMR_CURRENT);
+  }
+
+  SECTION("finest method")
+  {
+    amr_gradients_vs_central_differences(VKL_AMR_FINEST);
+  }
+
+  SECTION("octant method")
+  {
+    amr_gradients_vs_central_differences(VKL_AMR_OCTANT);
+  }
+}
@@ -0,0 +1,178 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+#include "rkcommon/memory/malloc.h"
+
+using namespace rkcommon;
+using namespace openvkl::testing;
+
+struct CountingAllocator
+{
+  std::atomic<size_t> numAllocations[VKL_ALLOCATION_NUM_CATEGORIES];
+  std::atomic<size_t> numFrees[VKL_ALLOCATION_NUM_CATEGORIES];
+  std::atomic<size_t> liveBytes{0};
+  std::atomic<bool> misaligned{false};
+  bool fail{false};
+
+  CountingAllocator()
+  {
+    for (int c = 0; c < VKL_ALLOCATION_NUM_CATEGORIES; c++) {
+      numAllocations[c] = 0;
+      numFrees[c]       = 0;
+    }
+  }
+
+  size_t totalAllocations() const
+  {
+    size_t n = 0;
+    for (int c = 0; c < VKL_ALLOCATION_NUM_CATEGORIES; c++)
+      n += numAllocations[c];
+    return n;
+  }
+
+  size_t totalFrees() const
+  {
+    size_t n = 0;
+    for (int c = 0; c < VKL_ALLOCATION_NUM_CATEGORIES; c++)
+      n += numFrees[c];
+    return n;
+  }
+};
+
+static void *countingAllocate(void *userData,
+                              size_t numBytes,
+                              size_t alignment,
+                              VKLAllocationCategory category)
+{
+  auto *allocator = static_cast<CountingAllocator *>(userData);
+
+  if (allocator->fail)
+    return nullptr;
+
+  void *ptr = memory::alignedMalloc(numBytes, alignment);
+
+  if (reinterpret_cast<uintptr_t>(ptr) % alignment != 0)
+    allocator->misaligned = true;
+
+  allocator->numAllocations[category] += 1;
+  allocator->liveBytes += numBytes;
+
+  return ptr;
+}
+
+static void countingFree(void *userData,
+                         void *ptr,
+                         size_t numBytes,
+                         VKLAllocationCategory category)
+{
+  auto *allocator = static_cast<CountingAllocator *>(userData);
+
+  allocator->numFrees[category] += 1;
+  allocator->liveBytes -= numBytes;
+
+  memory::alignedFree(ptr);
+}
+
+static VKLDriver setAllocator(CountingAllocator *allocator)
+{
+  VKLDriver driver = vklNewDriver("ispc");
+
+  if (allocator)
+    vklDriverSetAllocator(driver, countingAllocate, countingFree, allocator);
+
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  return driver;
+}
+
+TEST_CASE("Custom allocator", "[custom_allocator]")
+{
+  vklLoadModule("ispc_driver");
+
+  CountingAllocator allocator;
+
+  SECTION("owned data and volumes use the allocator")
+  {
+    setAllocator(&allocator);
+
+    std::vector<float> values(1 << 16, 1.f);
+
+    VKLData data = vklNewData(values.size(), VKL_FLOAT, values.data());
+    REQUIRE(allocator.numAllocations[VKL_ALLOCATION_DATA] == 1);
+    REQUIRE(allocator.liveBytes >= values.size() * sizeof(float));
+
+    // shared buffers are not allocated by Open VKL
+    VKLData shared = vklNewData(
+        values.size(), VKL_FLOAT, values.data(), VKL_DATA_SHARED_BUFFER);
+    REQUIRE(allocator.numAllocations[VKL_ALLOCATION_DATA] == 1);
+
+    {
+      WaveletStructuredRegularVolume<float> volume(
+          vec3i(64), vec3f(0.f), vec3f(1.f));
+      REQUIRE(volume.getVKLVolume() != nullptr);
+
+      REQUIRE(allocator.numAllocations[VKL_ALLOCATION_ACCELERATOR] > 0);
+      REQUIRE(allocator.numAllocations[VKL_ALLOCATION_AUXILIARY] > 0);
+    }
+
+    vklRelease(shared);
+    vklRelease(data);
+
+    REQUIRE(allocator.totalFrees() == allocator.totalAllocations());
+    REQUIRE(allocator.liveBytes == 0);
+    REQUIRE(!allocator.misaligned);
+  }
+
+  SECTION("buffers are freed by the allocator that allocated them")
+  {
+    setAllocator(&allocator);
+
+    std::vector<float> values(1024, 1.f);
+    VKLData data = vklNewData(values.size(), VKL_FLOAT, values.data());
+    REQUIRE(allocator.totalAllocations() == 1);
+
+    setAllocator(nullptr);
+
+    VKLData other = vklNewData(values.size(), VKL_FLOAT, values.data());
+    REQUIRE(allocator.totalAllocations() == 1);
+
+    vklRelease(other);
+    vklRelease(data);
+
+    REQUIRE(allocator.totalFrees() == 1);
+    REQUIRE(allocator.liveBytes == 0);
+  }
+
+  SECTION("failed allocations are reported as out of memory")
+  {
+    VKLDriver driver = setAllocator(&allocator);
+
+    allocator.fail = true;
+
+    std::vector<float> values(1024, 1.f);
+    VKLData data = vklNewData(values.size(), VKL_FLOAT, values.data());
+
+    REQUIRE(data == nullptr);
+    REQUIRE(vklDriverGetLastErrorCode(driver) == VKL_OUT_OF_MEMORY);
+    REQUIRE(allocator.totalFrees() == allocator.totalAllocations());
+  }
+
+  SECTION("allocate and free functions must be set together")
+  {
+    // errors are reported on the current driver
+    VKLDriver current = setAllocator(nullptr);
+
+    VKLDriver driver = vklNewDriver("ispc");
+    vklDriverSetAllocator(driver, countingAllocate, nullptr, &allocator);
+    REQUIRE(vklDriverGetLastErrorCode(current) != VKL_NO_ERROR);
+  }
+
+  // restore the default allocator for subsequent tests
+  setAllocator(nullptr);
+}
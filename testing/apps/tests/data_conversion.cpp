@@ -0,0 +1,121 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+
+using namespace rkcommon;
+using namespace rkcommon::math;
+
+static VKLVolume make_volume(const vec3i &dimensions, VKLData data)
+{
+  VKLVolume volume = vklNewVolume("structuredRegular");
+  vklSetVec3i(volume, "dimensions", dimensions.x, dimensions.y, dimensions.z);
+  vklSetData(volume, "data", data);
+  vklCommit(volume);
+  return volume;
+}
+
+// samples at voxel positions must reproduce the voxel values
+template <typename T>
+static void check_voxels(VKLVolume volume,
+                         const vec3i &dimensions,
+                         const std::vector<T> &voxels,
+                         size_t elementStride)
+{
+  VKLSampler sampler = vklNewSampler(volume);
+  vklCommit(sampler);
+
+  const vec3i step = max(dimensions / 8, vec3i(1));
+
+  for (int z = 0; z < dimensions.z; z += step.z)
+    for (int y = 0; y < dimensions.y; y += step.y)
+      for (int x = 0; x < dimensions.x; x += step.x) {
+        const size_t index =
+            (size_t(z) * dimensions.y + y) * dimensions.x + x;
+        const vkl_vec3f objectCoordinates{float(x), float(y), float(z)};
+
+        INFO("x = " << x << ", y = " << y << ", z = " << z);
+        REQUIRE(vklComputeSample(sampler, &objectCoordinates) ==
+                float(voxels[index * elementStride]));
+      }
+
+  vklRelease(sampler);
+}
+
+TEST_CASE("Data creation", "[data]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  SECTION("double to float conversion")
+  {
+    const vec3i dimensions(32);
+    std::vector<double> voxels(dimensions.long_product());
+    for (size_t i = 0; i < voxels.size(); i++)
+      voxels[i] = 0.25 * i;
+
+    VKLData data = vklNewDataConverted(
+        voxels.size(), VKL_FLOAT, voxels.data(), VKL_DOUBLE);
+    REQUIRE(data != nullptr);
+
+    VKLVolume volume = make_volume(dimensions, data);
+    vklRelease(data);
+
+    check_voxels(volume, dimensions, voxels, 1);
+    vklRelease(volume);
+  }
+
+  SECTION("unsupported conversion")
+  {
+    std::vector<float> voxels(16);
+
+    VKLData data = vklNewDataConverted(
+        voxels.size(), VKL_UCHAR, voxels.data(), VKL_FLOAT);
+    REQUIRE(data == nullptr);
+    REQUIRE(vklDriverGetLastErrorCode(driver) != VKL_NO_ERROR);
+  }
+
+  SECTION("large strided copy")
+  {
+    // large enough to be copied in parallel chunks
+    const vec3i dimensions(192);
+    const size_t elementStride = 3;
+
+    std::vector<float> voxels(dimensions.long_product() * elementStride);
+    for (size_t i = 0; i < voxels.size(); i++)
+      voxels[i] = float(i % 4099);
+
+    VKLData data = vklNewData(dimensions.long_product(),
+                              VKL_FLOAT,
+                              voxels.data(),
+                              VKL_DATA_DEFAULT,
+                              elementStride * sizeof(float));
+
+    VKLVolume volume = make_volume(dimensions, data);
+    vklRelease(data);
+
+    check_voxels(volume, dimensions, voxels, elementStride);
+    vklRelease(volume);
+  }
+
+  SECTION("large compact copy")
+  {
+    const vec3i dimensions(192);
+
+    std::vector<float> voxels(dimensions.long_product());
+    for (size_t i = 0; i < voxels.size(); i++)
+      voxels[i] = float(i % 4099);
+
+    VKLData data = vklNewData(voxels.size(), VKL_FLOAT, voxels.data());
+
+    VKLVolume volume = make_volume(dimensions, data);
+    vklRelease(data);
+
+    check_voxels(volume, dimensions, voxels, 1);
+    vklRelease(volume);
+  }
+}
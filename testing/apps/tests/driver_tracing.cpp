@@ -0,0 +1,63 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+
+using namespace rkcommon;
+using namespace openvkl::testing;
+
+static std::string read_file(const std::string &filename)
+{
+  std::ifstream in(filename);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+TEST_CASE("Driver tracing", "[driver_tracing]")
+{
+  const std::string filename = "openvkl_test_trace.json";
+  std::remove(filename.c_str());
+
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklDriverSetString(driver, "traceOutput", filename.c_str());
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  {
+    auto v = rkcommon::make_unique<WaveletStructuredRegularVolume<float>>(
+        vec3i(64), vec3f(0.f), vec3f(1.f));
+
+    VKLSampler sampler = vklNewSampler(v->getVKLVolume());
+    vklCommit(sampler);
+
+    std::vector<vkl_vec3f> objectCoordinates(16, vkl_vec3f{1.f, 1.f, 1.f});
+    std::vector<float> samples(objectCoordinates.size());
+
+    vklComputeSampleN(sampler,
+                      objectCoordinates.size(),
+                      objectCoordinates.data(),
+                      samples.data());
+
+    vklRelease(sampler);
+  }
+
+  // committing a different output writes the trace
+  vklDriverSetString(driver, "traceOutput", "");
+  vklCommitDriver(driver);
+
+  const std::string trace = read_file(filename);
+
+  REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+  REQUIRE(trace.find("StructuredRegularVolume::commit") != std::string::npos);
+  REQUIRE(trace.find("buildBrick") != std::string::npos);
+  REQUIRE(trace.find("vklComputeSampleN") != std::string::npos);
+
+  std::remove(filename.c_str());
+}
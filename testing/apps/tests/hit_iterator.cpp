@@ -43,6 +43,34 @@ void scalar_hit_iteration(VKLVolume volume,
   vklRelease(valueSelector);
 }
 
+std::vector<VKLHit> scalar_hits(VKLVolume volume,
+                                float isoValue,
+                                const vkl_vec3f &origin,
+                                const vkl_vec3f &direction)
+{
+  vkl_range1f tRange{0.f, inf};
+
+  VKLValueSelector valueSelector = vklNewValueSelector(volume);
+  vklValueSelectorSetValues(valueSelector, 1, &isoValue);
+  vklCommit(valueSelector);
+
+  std::vector<char> buffer(vklGetHitIteratorSize(volume));
+  VKLHitIterator iterator = vklInitHitIterator(
+      volume, &origin, &direction, &tRange, valueSelector, buffer.data());
+
+  std::vector<VKLHit> hits;
+
+  VKLHit hit;
+
+  while (vklIterateHit(iterator, &hit)) {
+    hits.push_back(hit);
+  }
+
+  vklRelease(valueSelector);
+
+  return hits;
+}
+
 TEST_CASE("Hit iterator", "[hit_iterators]")
 {
   vklLoadModule("ispc_driver");
@@ -116,6 +144,69 @@ TEST_CASE("Hit iterator", "[hit_iterators]")
                            vkl_vec3f{0.f, 0.f, -1.f});
     }
 
+    SECTION("structured volumes: analytic hits")
+    {
+      std::unique_ptr<ZProceduralVolume> v(
+          new ZProceduralVolume(vec3i(128), vec3f(0.f), vec3f(1.f)));
+
+      VKLVolume vklVolume = v->getVKLVolume();
+
+      vklSetBool(vklVolume, "analyticHits", true);
+      vklCommit(vklVolume);
+
+      // includes isovalues at grid accelerator macrocell boundaries
+      std::vector<float> isoValues;
+      std::vector<float> expectedTValues;
+
+      for (int i = 0; i < 128; i += 8) {
+        isoValues.push_back(float(i) + 0.25f);
+        expectedTValues.push_back(float(i) + 1.25f);
+      }
+
+      scalar_hit_iteration(vklVolume, isoValues, expectedTValues);
+    }
+
+    SECTION("structured volumes: analytic hits on a thin feature")
+    {
+      // x * y * z is reproduced exactly by trilinear interpolation
+      std::unique_ptr<XYZStructuredRegularVolume<float>> v(
+          new XYZStructuredRegularVolume<float>(
+              vec3i(32), vec3f(0.f), vec3f(1.f / 31.f)));
+
+      VKLVolume vklVolume = v->getVKLVolume();
+
+      vklSetBool(vklVolume, "analyticHits", true);
+      vklCommit(vklVolume);
+
+      // along this ray the field is z0 * (x0 + s t) * (y0 - s t), a parabola
+      // whose peak barely exceeds the isovalue: both crossings lie within a
+      // small fraction of a voxel
+      const double x0 = 0.3, y0 = 0.5, z0 = 0.6;
+      const double s  = std::sqrt(0.5);
+      const double m  = 0.5 * (x0 + y0);
+
+      const double halfWidth = 0.004;
+      const double u         = s * halfWidth;
+      const float isoValue   = float(z0 * (m * m - u * u));
+
+      const double tPeak = 0.5 * (y0 - x0) / s;
+
+      const std::vector<VKLHit> hits =
+          scalar_hits(vklVolume,
+                      isoValue,
+                      vkl_vec3f{float(x0), float(y0), float(z0)},
+                      vkl_vec3f{float(s), -float(s), 0.f});
+
+      REQUIRE(hits.size() == 2);
+
+      REQUIRE(hits[0].t == Approx(tPeak - halfWidth).margin(1e-4f));
+      REQUIRE(hits[1].t == Approx(tPeak + halfWidth).margin(1e-4f));
+
+      for (const auto &hit : hits) {
+        REQUIRE(hit.sample == isoValue);
+      }
+    }
+
     SECTION("unstructured volumes")
     {
       std::unique_ptr<ZUnstructuredProceduralVolume> v(
@@ -128,3 +219,107 @@ TEST_CASE("Hit iterator", "[hit_iterators]")
     }
   }
 }
+
+void batched_hit_iteration(VKLVolume volume,
+                           const std::vector<float> &isoValues,
+                           const std::vector<float> &expectedTValues)
+{
+  const vkl_vec3f origin{0.5f, 0.5f, -1.f};
+  const vkl_vec3f direction{0.f, 0.f, 1.f};
+  const vkl_range1f tRange{0.f, inf};
+
+  VKLValueSelector valueSelector = vklNewValueSelector(volume);
+  vklValueSelectorSetValues(valueSelector, isoValues.size(), isoValues.data());
+  vklCommit(valueSelector);
+
+  std::vector<char> buffer(vklGetHitIteratorSize(volume));
+
+  for (unsigned int maxHits : {0u, 1u, 4u, 64u}) {
+    INFO("maxHits = " << maxHits);
+
+    VKLHitIterator iterator = vklInitHitIterator(
+        volume, &origin, &direction, &tRange, valueSelector, buffer.data());
+
+    std::vector<VKLHit> hits;
+
+    if (maxHits == 0) {
+      REQUIRE(vklIterateHits(iterator, 0, nullptr) == 0);
+
+      // the iterator is unaffected
+      VKLHit hit;
+      while (vklIterateHit(iterator, &hit)) {
+        hits.push_back(hit);
+      }
+    } else {
+      std::vector<VKLHit> batch(maxHits);
+
+      while (true) {
+        const unsigned int numHits =
+            vklIterateHits(iterator, maxHits, batch.data());
+
+        REQUIRE(numHits <= maxHits);
+
+        hits.insert(hits.end(), batch.begin(), batch.begin() + numHits);
+
+        if (numHits < maxHits)
+          break;
+      }
+    }
+
+    REQUIRE(hits.size() == isoValues.size());
+
+    for (size_t i = 0; i < hits.size(); i++) {
+      REQUIRE(hits[i].t == Approx(expectedTValues[i]).margin(1e-3f));
+      REQUIRE(hits[i].sample == isoValues[i]);
+    }
+  }
+
+  vklRelease(valueSelector);
+}
+
+TEST_CASE("Batched hit iterator", "[hit_iterators]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  // for a unit cube physical grid [(0,0,0), (1,1,1)]
+  const vec3i dimensions(128);
+  const vec3f gridOrigin(0.f);
+  const vec3f gridSpacing(1.f / (128.f - 1.f));
+
+  std::vector<float> isoValues;
+  std::vector<float> expectedTValues;
+
+  for (float f = 0.1f; f < 1.f; f += 0.1f) {
+    isoValues.push_back(f);
+    expectedTValues.push_back(f + 1.f);
+  }
+
+  SECTION("structured volumes")
+  {
+    std::unique_ptr<ZProceduralVolume> v(
+        new ZProceduralVolume(dimensions, gridOrigin, gridSpacing));
+
+    batched_hit_iteration(v->getVKLVolume(), isoValues, expectedTValues);
+  }
+
+  SECTION("unstructured volumes")
+  {
+    std::unique_ptr<ZUnstructuredProceduralVolume> v(
+        new ZUnstructuredProceduralVolume(
+            dimensions, gridOrigin, gridSpacing, VKL_HEXAHEDRON, false));
+
+    batched_hit_iteration(v->getVKLVolume(), isoValues, expectedTValues);
+  }
+
+  SECTION("vdb volumes")
+  {
+    std::unique_ptr<ZVdbVolume> v(
+        new ZVdbVolume(dimensions, gridOrigin, gridSpacing));
+
+    batched_hit_iteration(v->getVKLVolume(), isoValues, expectedTValues);
+  }
+}
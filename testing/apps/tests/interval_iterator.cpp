@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "../../external/catch.hpp"
+#include "aos_soa_conversion.h"
 #include "iterator_utility.h"
 #include "openvkl_testing.h"
 #include "rkcommon/math/box.h"
@@ -175,6 +176,281 @@ void scalar_interval_value_ranges_with_value_selector(VKLVolume volume)
   vklRelease(sampler);
 }
 
+std::vector<VKLInterval> scalar_intervals(VKLVolume volume,
+                                          const vkl_vec3f &origin,
+                                          const vkl_vec3f &direction,
+                                          const vkl_range1f &tRange,
+                                          VKLValueSelector valueSelector)
+{
+  std::vector<char> buffer(vklGetIntervalIteratorSize(volume));
+  VKLIntervalIterator iterator = vklInitIntervalIterator(
+      volume, &origin, &direction, &tRange, valueSelector, buffer.data());
+
+  std::vector<VKLInterval> intervals;
+
+  VKLInterval interval;
+
+  while (vklIterateInterval(iterator, &interval)) {
+    intervals.push_back(interval);
+  }
+
+  return intervals;
+}
+
+void scalar_interval_value_ranges_with_many_value_selector_ranges(
+    VKLVolume volume)
+{
+  vkl_vec3f origin{0.5f, 0.5f, -1.f};
+  vkl_vec3f direction{0.f, 0.f, 1.f};
+  vkl_range1f tRange{0.f, inf};
+
+  // many narrow, unsorted, partially overlapping ranges (plus an empty one);
+  // these are sorted and merged internally
+  std::vector<vkl_range1f> valueRanges;
+
+  for (int i = 63; i >= 0; i--) {
+    const float lower = -4.f + 0.125f * i;
+    valueRanges.push_back({lower, lower + 0.01f});
+
+    if (i % 4 == 0) {
+      valueRanges.push_back({lower, lower + 0.005f});
+    }
+  }
+
+  valueRanges.push_back({1.f, -1.f});
+
+  // the equivalent merged set
+  std::vector<vkl_range1f> mergedRanges;
+
+  for (int i = 0; i < 64; i++) {
+    const float lower = -4.f + 0.125f * i;
+    mergedRanges.push_back({lower, lower + 0.01f});
+  }
+
+  VKLValueSelector valueSelector = vklNewValueSelector(volume);
+  vklValueSelectorSetRanges(
+      valueSelector, valueRanges.size(), valueRanges.data());
+  vklCommit(valueSelector);
+
+  VKLValueSelector mergedValueSelector = vklNewValueSelector(volume);
+  vklValueSelectorSetRanges(
+      mergedValueSelector, mergedRanges.size(), mergedRanges.data());
+  vklCommit(mergedValueSelector);
+
+  std::vector<VKLInterval> intervals =
+      scalar_intervals(volume, origin, direction, tRange, valueSelector);
+
+  std::vector<VKLInterval> mergedIntervals =
+      scalar_intervals(volume, origin, direction, tRange, mergedValueSelector);
+
+  REQUIRE(intervals.size() > 0);
+  REQUIRE(intervals.size() == mergedIntervals.size());
+
+  for (size_t i = 0; i < intervals.size(); i++) {
+    INFO("interval tRange = " << intervals[i].tRange.lower << ", "
+                              << intervals[i].tRange.upper);
+
+    REQUIRE(intervals[i].tRange.lower == mergedIntervals[i].tRange.lower);
+    REQUIRE(intervals[i].tRange.upper == mergedIntervals[i].tRange.upper);
+
+    bool rangeIntersectsValueSelector = false;
+
+    for (const auto &r : mergedRanges) {
+      if (rangesIntersect(r, intervals[i].valueRange)) {
+        rangeIntersectsValueSelector = true;
+        break;
+      }
+    }
+
+    REQUIRE(rangeIntersectsValueSelector);
+  }
+
+  vklRelease(mergedValueSelector);
+  vklRelease(valueSelector);
+}
+
+void scalar_interval_value_ranges_with_opacity_value_selector(VKLVolume volume)
+{
+  vkl_vec3f origin{0.5f, 0.5f, -1.f};
+  vkl_vec3f direction{0.f, 0.f, 1.f};
+  vkl_range1f tRange{0.f, inf};
+
+  // only the central segments of the piecewise linear transfer function have
+  // positive opacity, i.e. values in [-0.5, 0.5]
+  vkl_range1f opacityValueRange{-1.f, 1.f};
+  std::vector<float> opacities{0.f, 0.f, 1.f, 0.f, 0.f};
+
+  std::vector<vkl_range1f> equivalentRanges{{-0.5f, 0.5f}};
+
+  VKLValueSelector valueSelector = vklNewValueSelector(volume);
+  vklValueSelectorSetOpacities(
+      valueSelector, &opacityValueRange, opacities.size(), opacities.data());
+  vklCommit(valueSelector);
+
+  VKLValueSelector equivalentValueSelector = vklNewValueSelector(volume);
+  vklValueSelectorSetRanges(equivalentValueSelector,
+                            equivalentRanges.size(),
+                            equivalentRanges.data());
+  vklCommit(equivalentValueSelector);
+
+  std::vector<VKLInterval> intervals =
+      scalar_intervals(volume, origin, direction, tRange, valueSelector);
+
+  std::vector<VKLInterval> equivalentIntervals = scalar_intervals(
+      volume, origin, direction, tRange, equivalentValueSelector);
+
+  REQUIRE(intervals.size() > 0);
+  REQUIRE(intervals.size() == equivalentIntervals.size());
+
+  for (size_t i = 0; i < intervals.size(); i++) {
+    INFO("interval tRange = " << intervals[i].tRange.lower << ", "
+                              << intervals[i].tRange.upper);
+
+    REQUIRE(intervals[i].tRange.lower == equivalentIntervals[i].tRange.lower);
+    REQUIRE(intervals[i].tRange.upper == equivalentIntervals[i].tRange.upper);
+    REQUIRE(rangesIntersect(equivalentRanges[0], intervals[i].valueRange));
+  }
+
+  vklRelease(equivalentValueSelector);
+  vklRelease(valueSelector);
+}
+
+// the largest transfer function opacity over the given value range, with
+// opacities linearly interpolated between uniformly spaced samples and clamped
+// outside the transfer function value range
+float maxOpacity(const vkl_range1f &opacityValueRange,
+                 const std::vector<float> &opacities,
+                 const vkl_range1f &valueRange)
+{
+  const float lower   = opacityValueRange.lower;
+  const float upper   = opacityValueRange.upper;
+  const float spacing = (upper - lower) / float(opacities.size() - 1);
+
+  float result = 0.f;
+
+  if (valueRange.lower <= lower) {
+    result = std::max(result, opacities.front());
+  }
+
+  if (valueRange.upper >= upper) {
+    result = std::max(result, opacities.back());
+  }
+
+  for (size_t i = 0; i < opacities.size() - 1; i++) {
+    const vkl_range1f segment{lower + float(i) * spacing,
+                              lower + float(i + 1) * spacing};
+
+    if (rangesIntersect(segment, valueRange)) {
+      result = std::max(result, std::max(opacities[i], opacities[i + 1]));
+    }
+  }
+
+  return result;
+}
+
+void scalar_interval_majorants(VKLVolume volume)
+{
+  vkl_vec3f origin{0.5f, 0.5f, -1.f};
+  vkl_vec3f direction{0.f, 0.f, 1.f};
+  vkl_range1f tRange{0.f, inf};
+
+  VKLSampler sampler = vklNewSampler(volume);
+
+  // without a value selector, majorants bound the absolute sampled values
+  std::vector<VKLInterval> intervals =
+      scalar_intervals(volume, origin, direction, tRange, nullptr);
+
+  REQUIRE(intervals.size() > 0);
+
+  for (const auto &interval : intervals) {
+    vkl_range1f sampledValueRange =
+        computeIntervalValueRange(sampler, origin, direction, interval.tRange);
+
+    INFO("sampled value range = " << sampledValueRange.lower << ", "
+                                  << sampledValueRange.upper
+                                  << ", majorant = " << interval.majorant);
+
+    REQUIRE(interval.majorant >= std::abs(sampledValueRange.lower));
+    REQUIRE(interval.majorant >= std::abs(sampledValueRange.upper));
+  }
+
+  // with an opacity value selector, majorants are the maximum opacities of
+  // the transfer function over the interval, scaled by majorantScale
+  vkl_range1f opacityValueRange{-1.f, 1.f};
+  std::vector<float> opacities{0.f, 0.25f, 0.5f, 0.25f, 0.f};
+
+  VKLValueSelector valueSelector = vklNewValueSelector(volume);
+  vklValueSelectorSetOpacities(
+      valueSelector, &opacityValueRange, opacities.size(), opacities.data());
+  vklSetFloat(valueSelector, "majorantScale", 2.f);
+  vklCommit(valueSelector);
+
+  intervals =
+      scalar_intervals(volume, origin, direction, tRange, valueSelector);
+
+  REQUIRE(intervals.size() > 0);
+
+  for (const auto &interval : intervals) {
+    INFO("interval value range = " << interval.valueRange.lower << ", "
+                                   << interval.valueRange.upper
+                                   << ", majorant = " << interval.majorant);
+
+    REQUIRE(interval.majorant > 0.f);
+    REQUIRE(interval.majorant ==
+            Approx(2.f * maxOpacity(
+                             opacityValueRange, opacities, interval.valueRange)));
+  }
+
+  vklRelease(valueSelector);
+  vklRelease(sampler);
+}
+
+// expects a volume whose values ramp from 0 to 1 along z over the unit cube,
+// so that intervals fall into different transfer function segments
+void scalar_interval_majorants_per_segment(VKLVolume volume)
+{
+  vkl_vec3f origin{0.5f, 0.5f, -1.f};
+  vkl_vec3f direction{0.f, 0.f, 1.f};
+  vkl_range1f tRange{0.f, inf};
+
+  // segment max opacities are 0.25 over [-1, -0.5], 0.5 over [-0.5, 0.5] and
+  // 0.25 over [0.5, 1]
+  vkl_range1f opacityValueRange{-1.f, 1.f};
+  std::vector<float> opacities{0.f, 0.25f, 0.5f, 0.25f, 0.f};
+
+  VKLValueSelector valueSelector = vklNewValueSelector(volume);
+  vklValueSelectorSetOpacities(
+      valueSelector, &opacityValueRange, opacities.size(), opacities.data());
+  vklCommit(valueSelector);
+
+  std::vector<VKLInterval> intervals =
+      scalar_intervals(volume, origin, direction, tRange, valueSelector);
+
+  REQUIRE(intervals.size() > 0);
+
+  size_t numCentralIntervals = 0;
+  size_t numUpperIntervals   = 0;
+
+  for (const auto &interval : intervals) {
+    INFO("interval value range = " << interval.valueRange.lower << ", "
+                                   << interval.valueRange.upper
+                                   << ", majorant = " << interval.majorant);
+
+    if (interval.valueRange.lower <= 0.5f) {
+      REQUIRE(interval.majorant == 0.5f);
+      numCentralIntervals++;
+    } else {
+      REQUIRE(interval.majorant <= 0.25f);
+      numUpperIntervals++;
+    }
+  }
+
+  REQUIRE(numCentralIntervals > 0);
+  REQUIRE(numUpperIntervals > 0);
+
+  vklRelease(valueSelector);
+}
+
 void scalar_interval_nominalDeltaT(VKLVolume volume,
                                    const vec3f &direction,
                                    const float expectedNominalDeltaT)
@@ -211,6 +487,390 @@ void scalar_interval_nominalDeltaT(VKLVolume volume,
   REQUIRE(interval.nominalDeltaT == Approx(expectedNominalDeltaT));
 }
 
+void scalar_interval_adaptive_nominalDeltaT(VKLVolume volume,
+                                            const float defaultNominalDeltaT)
+{
+  vklSetBool(volume, "adaptiveNominalDeltaT", true);
+  vklCommit(volume);
+
+  vkl_vec3f origin{-1.f, 0.5f, 0.5f};
+  vkl_vec3f direction{1.f, 0.f, 0.f};
+  vkl_range1f tRange{0.f, inf};
+
+  std::vector<char> buffer(vklGetIntervalIteratorSize(volume));
+  VKLIntervalIterator iterator = vklInitIntervalIterator(
+      volume, &origin, &direction, &tRange, nullptr, buffer.data());
+
+  VKLInterval interval;
+
+  float minNominalDeltaT = inf;
+  float maxNominalDeltaT = -inf;
+
+  int intervalCount = 0;
+
+  while (vklIterateInterval(iterator, &interval)) {
+    INFO("interval tRange = " << interval.tRange.lower << ", "
+                              << interval.tRange.upper << ", nominalDeltaT = "
+                              << interval.nominalDeltaT);
+
+    // scale factors are bounded to [1/4, 4] times the default step
+    REQUIRE(interval.nominalDeltaT >= 0.25f * defaultNominalDeltaT * 0.999f);
+    REQUIRE(interval.nominalDeltaT <= 4.f * defaultNominalDeltaT * 1.001f);
+
+    minNominalDeltaT = std::min(minNominalDeltaT, interval.nominalDeltaT);
+    maxNominalDeltaT = std::max(maxNominalDeltaT, interval.nominalDeltaT);
+
+    intervalCount++;
+  }
+
+  REQUIRE(intervalCount > 1);
+
+  // the wavelet field is not uniformly smooth, so steps should vary
+  REQUIRE(minNominalDeltaT < maxNominalDeltaT);
+
+  // restore default behavior for any subsequent use of the volume
+  vklSetBool(volume, "adaptiveNominalDeltaT", false);
+  vklCommit(volume);
+}
+
+// four 16^3 bricks of unit cells side by side along x; the first brick is 0
+// and all others are 1, so values strictly between 0 and 1 are only reached
+// within half a cell of x = 16, the boundary between the first two k-d tree
+// leaves
+VKLVolume newAMRStepVolume()
+{
+  const int blockSize = 16;
+
+  const std::vector<float> cellWidths{1.f};
+
+  std::vector<box3i> blockBounds;
+  std::vector<int> refinementLevels;
+  std::vector<VKLData> blockData;
+
+  for (int b = 0; b < 4; b++) {
+    // block bound upper bounds are inclusive, hence subtracting 1
+    blockBounds.emplace_back(
+        vec3i(b * blockSize, 0, 0),
+        vec3i((b + 1) * blockSize - 1, blockSize - 1, blockSize - 1));
+    refinementLevels.push_back(0);
+
+    const std::vector<float> voxels(blockSize * blockSize * blockSize,
+                                    b == 0 ? 0.f : 1.f);
+    blockData.push_back(vklNewData(voxels.size(), VKL_FLOAT, voxels.data()));
+  }
+
+  VKLData blockDataData =
+      vklNewData(blockData.size(), VKL_DATA, blockData.data());
+  VKLData blockBoundsData =
+      vklNewData(blockBounds.size(), VKL_BOX3I, blockBounds.data());
+  VKLData refinementLevelsData =
+      vklNewData(refinementLevels.size(), VKL_INT, refinementLevels.data());
+  VKLData cellWidthsData =
+      vklNewData(cellWidths.size(), VKL_FLOAT, cellWidths.data());
+
+  VKLVolume volume = vklNewVolume("amr");
+
+  vklSetData(volume, "block.data", blockDataData);
+  vklSetData(volume, "block.bounds", blockBoundsData);
+  vklSetData(volume, "block.level", refinementLevelsData);
+  vklSetData(volume, "cellWidth", cellWidthsData);
+
+  vklRelease(blockDataData);
+  vklRelease(blockBoundsData);
+  vklRelease(refinementLevelsData);
+  vklRelease(cellWidthsData);
+
+  for (auto &d : blockData)
+    vklRelease(d);
+
+  vklCommit(volume);
+
+  return volume;
+}
+
+// expects the volume returned by newAMRStepVolume()
+void amr_interval_empty_space_skipping(VKLVolume volume)
+{
+  vkl_vec3f origin{-1.f, 8.5f, 8.5f};
+  vkl_vec3f direction{1.f, 0.f, 0.f};
+  vkl_range1f tRange{0.f, inf};
+
+  const vkl_box3f vklBoundingBox = vklGetBoundingBox(volume);
+  const range1f boundingBoxTRange =
+      intersectRayBox((const vec3f &)origin,
+                      (const vec3f &)direction,
+                      (const box3f &)vklBoundingBox);
+
+  // the selected range is only reached in the first leaf, just below its
+  // upper face
+  const vkl_vec3f boundaryPosition{15.75f, 8.5f, 8.5f};
+  const float boundaryT = boundaryPosition.x - origin.x;
+
+  VKLSampler sampler = vklNewSampler(volume);
+  vklCommit(sampler);
+
+  REQUIRE(vklComputeSample(sampler, &boundaryPosition) == Approx(0.25f));
+
+  vklRelease(sampler);
+
+  VKLValueSelector valueSelector = vklNewValueSelector(volume);
+
+  vkl_range1f valueRange{0.2f, 0.3f};
+  vklValueSelectorSetRanges(valueSelector, 1, &valueRange);
+  vklCommit(valueSelector);
+
+  std::vector<char> buffer(vklGetIntervalIteratorSize(volume));
+  VKLIntervalIterator iterator = vklInitIntervalIterator(
+      volume, &origin, &direction, &tRange, valueSelector, buffer.data());
+
+  VKLInterval interval;
+
+  float previousUpper = -inf;
+  bool boundaryFound  = false;
+
+  while (vklIterateInterval(iterator, &interval)) {
+    INFO("interval tRange = " << interval.tRange.lower << ", "
+                              << interval.tRange.upper
+                              << " valueRange = " << interval.valueRange.lower
+                              << ", " << interval.valueRange.upper);
+
+    // intervals are front-to-back, non-overlapping, and within the volume
+    REQUIRE(interval.tRange.lower < interval.tRange.upper);
+    REQUIRE(interval.tRange.lower >= previousUpper);
+    REQUIRE(interval.tRange.lower >= boundingBoxTRange.lower);
+    REQUIRE(interval.tRange.upper <= boundingBoxTRange.upper);
+
+    REQUIRE(interval.valueRange.upper >= valueRange.lower);
+    REQUIRE(interval.valueRange.lower <= valueRange.upper);
+
+    // the last two bricks are constant and far enough from the step to be
+    // skipped
+    REQUIRE(interval.tRange.upper <= 32.f - origin.x);
+
+    if (interval.tRange.lower <= boundaryT &&
+        interval.tRange.upper >= boundaryT) {
+      boundaryFound = true;
+    }
+
+    previousUpper = interval.tRange.upper;
+  }
+
+  REQUIRE(boundaryFound);
+
+  vklRelease(valueSelector);
+}
+
+void spherical_interval_empty_space_skipping(VKLVolume volume,
+                                             float innerRadius)
+{
+  // slightly off the z axis, which is singular in azimuth
+  vkl_vec3f origin{0.01f, 0.02f, -2.f};
+  vkl_vec3f direction{0.f, 0.f, 1.f};
+  vkl_range1f tRange{0.f, inf};
+
+  // ray segment inside the inner radius of the spherical shell
+  const float rho2       = origin.x * origin.x + origin.y * origin.y;
+  const float halfChord  = std::sqrt(innerRadius * innerRadius - rho2);
+  const range1f holeTRange(-origin.z - halfChord, -origin.z + halfChord);
+  const float tolerance = 1e-3f;
+
+  std::vector<char> buffer(vklGetIntervalIteratorSize(volume));
+  VKLIntervalIterator iterator = vklInitIntervalIterator(
+      volume, &origin, &direction, &tRange, nullptr, buffer.data());
+
+  VKLInterval interval;
+
+  float previousUpper = -inf;
+  int intervalCount   = 0;
+  int gapCount        = 0;
+
+  while (vklIterateInterval(iterator, &interval)) {
+    INFO("interval tRange = " << interval.tRange.lower << ", "
+                              << interval.tRange.upper
+                              << " valueRange = " << interval.valueRange.lower
+                              << ", " << interval.valueRange.upper);
+
+    REQUIRE(interval.tRange.lower < interval.tRange.upper);
+    REQUIRE(interval.tRange.lower >= previousUpper);
+    REQUIRE(interval.nominalDeltaT > 0.f);
+
+    // nothing is returned inside the shell
+    const bool overlapsHole =
+        interval.tRange.upper > holeTRange.lower + tolerance &&
+        interval.tRange.lower < holeTRange.upper - tolerance;
+    REQUIRE(!overlapsHole);
+
+    if (intervalCount > 0 && interval.tRange.lower != previousUpper) {
+      gapCount++;
+    }
+
+    previousUpper = interval.tRange.upper;
+    intervalCount++;
+  }
+
+  // the shell is entered twice, with macrocells adjacent within the grid
+  REQUIRE(intervalCount > 1);
+  REQUIRE(gapCount == 1);
+}
+
+// iterates a single ray on lane 0 of the given vectorized interval iterator
+// API; all other lanes are inactive.
+template <int W,
+          typename IteratorN,
+          typename IntervalN,
+          typename VVec3fN,
+          typename VRange1fN>
+std::vector<VKLInterval> vectorized_intervals(
+    VKLVolume volume,
+    const vec3f &origin,
+    const vec3f &direction,
+    const vkl_range1f &tRange,
+    size_t (*getSize)(VKLVolume),
+    IteratorN (*init)(const int *,
+                      VKLVolume,
+                      const VVec3fN *,
+                      const VVec3fN *,
+                      const VRange1fN *,
+                      VKLValueSelector,
+                      void *),
+    void (*iterate)(const int *, IteratorN, IntervalN *, int *))
+{
+  std::vector<int> valid(W, 0);
+  valid[0] = 1;
+
+  AlignedVector<float> originsSOA =
+      AOStoSOA_vec3f(std::vector<vec3f>{origin}, W);
+  AlignedVector<float> directionsSOA =
+      AOStoSOA_vec3f(std::vector<vec3f>{direction}, W);
+  AlignedVector<float> tRangesSOA =
+      AOStoSOA_range1f(std::vector<vkl_range1f>{tRange}, W);
+
+  std::vector<char> buffer(getSize(volume));
+  IteratorN iterator = init(valid.data(),
+                            volume,
+                            (const VVec3fN *)originsSOA.data(),
+                            (const VVec3fN *)directionsSOA.data(),
+                            (const VRange1fN *)tRangesSOA.data(),
+                            nullptr,
+                            buffer.data());
+
+  std::vector<VKLInterval> intervals;
+
+  IntervalN intervalN;
+  int result[W];
+
+  while (true) {
+    iterate(valid.data(), iterator, &intervalN, result);
+
+    if (!result[0]) {
+      break;
+    }
+
+    VKLInterval interval;
+    interval.tRange.lower     = intervalN.tRange.lower[0];
+    interval.tRange.upper     = intervalN.tRange.upper[0];
+    interval.valueRange.lower = intervalN.valueRange.lower[0];
+    interval.valueRange.upper = intervalN.valueRange.upper[0];
+    interval.nominalDeltaT    = intervalN.nominalDeltaT[0];
+    interval.majorant         = intervalN.majorant[0];
+    intervals.push_back(interval);
+  }
+
+  return intervals;
+}
+
+// the scalar API uses dedicated uniform iterator implementations where
+// available; these must produce the same intervals as the vectorized API
+void scalar_interval_matches_vectorized(VKLVolume volume)
+{
+  const int nativeWidth = vklGetNativeSIMDWidth();
+
+  const vkl_box3f bbox = vklGetBoundingBox(volume);
+  const vec3f lower(bbox.lower.x, bbox.lower.y, bbox.lower.z);
+  const vec3f upper(bbox.upper.x, bbox.upper.y, bbox.upper.z);
+  const vec3f extent = upper - lower;
+
+  const vkl_range1f tRange{0.f, inf};
+
+  std::vector<char> buffer(vklGetIntervalIteratorSize(volume));
+
+  for (int i = 0; i < 8; i++) {
+    // stay clear of cell and node boundaries along x and y
+    const float fx = (i + 0.37f) / 8.f;
+    const float fy = (i + 0.61f) / 8.f;
+
+    const vec3f origin =
+        lower + vec3f(fx, fy, 0.f) * extent - vec3f(0.f, 0.f, 1.f);
+    const vec3f direction =
+        i % 2 ? vec3f(0.f, 0.f, 1.f) : normalize(vec3f(0.1f, 0.2f, 1.f));
+
+    VKLIntervalIterator iterator =
+        vklInitIntervalIterator(volume,
+                                (const vkl_vec3f *)&origin,
+                                (const vkl_vec3f *)&direction,
+                                &tRange,
+                                nullptr,
+                                buffer.data());
+
+    std::vector<VKLInterval> scalarIntervals;
+
+    VKLInterval interval;
+    while (vklIterateInterval(iterator, &interval)) {
+      scalarIntervals.push_back(interval);
+    }
+
+    std::vector<VKLInterval> vectorizedIntervals;
+
+    if (nativeWidth == 4) {
+      vectorizedIntervals =
+          vectorized_intervals<4>(volume,
+                                  origin,
+                                  direction,
+                                  tRange,
+                                  vklGetIntervalIteratorSize4,
+                                  vklInitIntervalIterator4,
+                                  vklIterateInterval4);
+    } else if (nativeWidth == 8) {
+      vectorizedIntervals =
+          vectorized_intervals<8>(volume,
+                                  origin,
+                                  direction,
+                                  tRange,
+                                  vklGetIntervalIteratorSize8,
+                                  vklInitIntervalIterator8,
+                                  vklIterateInterval8);
+    } else if (nativeWidth == 16) {
+      vectorizedIntervals =
+          vectorized_intervals<16>(volume,
+                                   origin,
+                                   direction,
+                                   tRange,
+                                   vklGetIntervalIteratorSize16,
+                                   vklInitIntervalIterator16,
+                                   vklIterateInterval16);
+    }
+
+    INFO("ray " << i);
+
+    REQUIRE(scalarIntervals.size() > 0);
+    REQUIRE(scalarIntervals.size() == vectorizedIntervals.size());
+
+    for (size_t j = 0; j < scalarIntervals.size(); j++) {
+      const VKLInterval &s = scalarIntervals[j];
+      const VKLInterval &v = vectorizedIntervals[j];
+
+      INFO("interval " << j);
+
+      REQUIRE(s.tRange.lower == Approx(v.tRange.lower).margin(1e-5f));
+      REQUIRE(s.tRange.upper == Approx(v.tRange.upper).margin(1e-5f));
+      REQUIRE(s.valueRange.lower == v.valueRange.lower);
+      REQUIRE(s.valueRange.upper == v.valueRange.upper);
+      REQUIRE(s.nominalDeltaT == Approx(v.nominalDeltaT));
+      REQUIRE(s.majorant == v.majorant);
+    }
+  }
+}
+
 TEST_CASE("Interval iterator", "[interval_iterators]")
 {
   vklLoadModule("ispc_driver");
@@ -245,6 +905,39 @@ TEST_CASE("Interval iterator", "[interval_iterators]")
     {
       scalar_interval_value_ranges_with_value_selector(vklVolume);
     }
+
+    SECTION("scalar interval value ranges with many value selector ranges")
+    {
+      scalar_interval_value_ranges_with_many_value_selector_ranges(vklVolume);
+    }
+
+    SECTION("scalar interval value ranges with opacity value selector")
+    {
+      scalar_interval_value_ranges_with_opacity_value_selector(vklVolume);
+    }
+
+    SECTION("scalar interval majorants")
+    {
+      scalar_interval_majorants(vklVolume);
+    }
+
+    SECTION("scalar intervals match vectorized intervals")
+    {
+      scalar_interval_matches_vectorized(vklVolume);
+    }
+  }
+
+  SECTION("structured volumes: interval majorants per segment")
+  {
+    // for a unit cube physical grid [(0,0,0), (1,1,1)]
+    const vec3i dimensions(128);
+    const vec3f gridOrigin(0.f);
+    const vec3f gridSpacing(1.f / (128.f - 1.f));
+
+    auto v = rkcommon::make_unique<ZProceduralVolume>(
+        dimensions, gridOrigin, gridSpacing);
+
+    scalar_interval_majorants_per_segment(v->getVKLVolume());
   }
 
   SECTION("structured volumes: interval nominalDeltaT")
@@ -321,6 +1014,75 @@ TEST_CASE("Interval iterator", "[interval_iterators]")
     }
   }
 
+  SECTION("structured volumes: adaptive interval nominalDeltaT")
+  {
+    const vec3i dimensions(128);
+    const vec3f gridOrigin(0.f);
+    const vec3f gridSpacing(1.f / (128.f - 1.f));
+
+    auto v = rkcommon::make_unique<WaveletStructuredRegularVolume<float>>(
+        dimensions, gridOrigin, gridSpacing);
+
+    VKLVolume vklVolume = v->getVKLVolume();
+
+    scalar_interval_adaptive_nominalDeltaT(vklVolume, gridSpacing.x);
+  }
+
+  SECTION("structured spherical volumes")
+  {
+    const vec3i dimensions(64);
+
+    constexpr float epsilon = std::numeric_limits<float>::epsilon();
+
+    SECTION("full sphere")
+    {
+      vec3f gridOrigin;
+      vec3f gridSpacing;
+      WaveletStructuredSphericalVolume<float>::generateGridParameters(
+          dimensions, 2.f, gridOrigin, gridSpacing);
+
+      auto v = rkcommon::make_unique<WaveletStructuredSphericalVolume<float>>(
+          dimensions, gridOrigin, gridSpacing);
+
+      VKLVolume vklVolume = v->getVKLVolume();
+
+      SECTION("scalar interval value ranges with no value selector")
+      {
+        scalar_interval_value_ranges_with_no_value_selector(vklVolume);
+      }
+
+      SECTION("scalar interval value ranges with value selector")
+      {
+        scalar_interval_value_ranges_with_value_selector(vklVolume);
+      }
+
+      SECTION("scalar interval majorants")
+      {
+        scalar_interval_majorants(vklVolume);
+      }
+    }
+
+    SECTION("spherical shell")
+    {
+      const float innerRadius = 0.5f;
+
+      const vec3f gridOrigin(innerRadius, 0.f, 0.f);
+      const vec3f gridSpacing((1.f - innerRadius) / (dimensions.x - 1),
+                              180.f / (dimensions.y - 1) - epsilon,
+                              360.f / (dimensions.z - 1) - epsilon);
+
+      auto v = rkcommon::make_unique<WaveletStructuredSphericalVolume<float>>(
+          dimensions, gridOrigin, gridSpacing);
+
+      VKLVolume vklVolume = v->getVKLVolume();
+
+      SECTION("scalar interval empty space skipping")
+      {
+        spherical_interval_empty_space_skipping(vklVolume, innerRadius);
+      }
+    }
+  }
+
   SECTION("unstructured volumes")
   {
     // for a unit cube physical grid [(0,0,0), (1,1,1)]
@@ -347,5 +1109,59 @@ TEST_CASE("Interval iterator", "[interval_iterators]")
     {
       scalar_interval_value_ranges_with_value_selector(vklVolume);
     }
+
+    SECTION("scalar interval value ranges with opacity value selector")
+    {
+      scalar_interval_value_ranges_with_opacity_value_selector(vklVolume);
+    }
+
+    SECTION("scalar interval majorants")
+    {
+      scalar_interval_majorants(vklVolume);
+    }
+
+    SECTION("scalar intervals match vectorized intervals")
+    {
+      scalar_interval_matches_vectorized(vklVolume);
+    }
+  }
+
+  SECTION("vdb volumes")
+  {
+    const vec3i dimensions(128);
+    const vec3f gridOrigin(0.f);
+    const vec3f gridSpacing(1.f / (128.f - 1.f));
+
+    auto v = rkcommon::make_unique<WaveletVdbVolume>(
+        dimensions, gridOrigin, gridSpacing);
+
+    VKLVolume vklVolume = v->getVKLVolume();
+
+    SECTION("scalar intervals match vectorized intervals")
+    {
+      scalar_interval_matches_vectorized(vklVolume);
+    }
+  }
+
+  SECTION("amr volumes")
+  {
+    const vec3i dimensions(64);
+
+    auto v = rkcommon::make_unique<ProceduralShellsAMRVolume<>>(
+        dimensions, vec3f(0.f), vec3f(1.f));
+
+    VKLVolume vklVolume = v->getVKLVolume();
+
+    SECTION("scalar interval continuity with no value selector")
+    {
+      scalar_interval_continuity_with_no_value_selector(vklVolume);
+    }
+
+    SECTION("scalar interval empty space skipping")
+    {
+      VKLVolume stepVolume = newAMRStepVolume();
+      amr_interval_empty_space_skipping(stepVolume);
+      vklRelease(stepVolume);
+    }
   }
 }
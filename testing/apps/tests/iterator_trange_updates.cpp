@@ -0,0 +1,281 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+
+using namespace rkcommon;
+using namespace openvkl::testing;
+
+static const vkl_vec3f rayOrigin{0.5f, 0.5f, -1.f};
+static const vkl_vec3f rayDirection{0.f, 0.f, 1.f};
+
+std::vector<VKLInterval> all_intervals(VKLVolume volume)
+{
+  vkl_range1f tRange{0.f, inf};
+
+  std::vector<char> buffer(vklGetIntervalIteratorSize(volume));
+  VKLIntervalIterator iterator = vklInitIntervalIterator(
+      volume, &rayOrigin, &rayDirection, &tRange, nullptr, buffer.data());
+
+  std::vector<VKLInterval> intervals;
+
+  VKLInterval interval;
+  while (vklIterateInterval(iterator, &interval)) {
+    intervals.push_back(interval);
+  }
+
+  return intervals;
+}
+
+void interval_trange_updates(VKLVolume volume)
+{
+  const std::vector<VKLInterval> reference = all_intervals(volume);
+
+  REQUIRE(reference.size() > 1);
+
+  const float tBegin = reference.front().tRange.lower;
+  const float tEnd   = reference.back().tRange.upper;
+
+  const float tCut = tBegin + 0.5f * (tEnd - tBegin);
+
+  std::vector<char> buffer(vklGetIntervalIteratorSize(volume));
+
+  SECTION("shrinking tRange.upper after the first interval")
+  {
+    vkl_range1f tRange{0.f, inf};
+    VKLIntervalIterator iterator = vklInitIntervalIterator(
+        volume, &rayOrigin, &rayDirection, &tRange, nullptr, buffer.data());
+
+    VKLInterval interval;
+    REQUIRE(vklIterateInterval(iterator, &interval));
+
+    const vkl_range1f newTRange{0.f, tCut};
+    vklSetIntervalIteratorTRange(iterator, &newTRange);
+
+    size_t count = 1;
+
+    while (vklIterateInterval(iterator, &interval)) {
+      INFO("interval tRange = " << interval.tRange.lower << ", "
+                                << interval.tRange.upper);
+      REQUIRE(interval.tRange.lower < tCut);
+      count++;
+    }
+
+    REQUIRE(count < reference.size());
+  }
+
+  SECTION("advancing tRange.lower before iterating")
+  {
+    vkl_range1f tRange{0.f, inf};
+    VKLIntervalIterator iterator = vklInitIntervalIterator(
+        volume, &rayOrigin, &rayDirection, &tRange, nullptr, buffer.data());
+
+    const vkl_range1f newTRange{tCut, inf};
+    vklSetIntervalIteratorTRange(iterator, &newTRange);
+
+    std::vector<VKLInterval> intervals;
+
+    VKLInterval interval;
+    while (vklIterateInterval(iterator, &interval)) {
+      INFO("interval tRange = " << interval.tRange.lower << ", "
+                                << interval.tRange.upper);
+      REQUIRE(interval.tRange.upper >= tCut);
+      intervals.push_back(interval);
+    }
+
+    REQUIRE(!intervals.empty());
+    REQUIRE(intervals.size() < reference.size());
+
+    // the remainder of the ray is still covered
+    REQUIRE(intervals.front().tRange.lower <= tCut + 1e-5f);
+    REQUIRE(intervals.back().tRange.upper == Approx(tEnd).margin(1e-5f));
+  }
+
+  SECTION("empty tRange terminates iteration")
+  {
+    vkl_range1f tRange{0.f, inf};
+    VKLIntervalIterator iterator = vklInitIntervalIterator(
+        volume, &rayOrigin, &rayDirection, &tRange, nullptr, buffer.data());
+
+    const vkl_range1f newTRange{tCut, tCut - 0.1f};
+    vklSetIntervalIteratorTRange(iterator, &newTRange);
+
+    VKLInterval interval;
+    REQUIRE(!vklIterateInterval(iterator, &interval));
+  }
+}
+
+TEST_CASE("Interval iterator tRange updates", "[interval_iterators]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  // for a unit cube physical grid [(0,0,0), (1,1,1)]
+  const vec3i dimensions(128);
+  const vec3f gridOrigin(0.f);
+  const vec3f gridSpacing(1.f / (128.f - 1.f));
+
+  SECTION("structured volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletStructuredRegularVolume<float>>(
+        dimensions, gridOrigin, gridSpacing);
+
+    interval_trange_updates(v->getVKLVolume());
+  }
+
+  SECTION("unstructured volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletUnstructuredProceduralVolume>(
+        dimensions, gridOrigin, gridSpacing, VKL_HEXAHEDRON, false);
+
+    interval_trange_updates(v->getVKLVolume());
+  }
+
+  SECTION("vdb volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletVdbVolume>(
+        dimensions, gridOrigin, gridSpacing);
+
+    interval_trange_updates(v->getVKLVolume());
+  }
+
+  SECTION("amr volumes")
+  {
+    auto v = rkcommon::make_unique<ProceduralShellsAMRVolume<>>(
+        dimensions, gridOrigin, gridSpacing);
+
+    interval_trange_updates(v->getVKLVolume());
+  }
+
+  SECTION("structured spherical volumes")
+  {
+    // a sphere of radius 1 around the origin, which the ray intersects
+    vec3f sphericalGridOrigin;
+    vec3f sphericalGridSpacing;
+    WaveletStructuredSphericalVolume<float>::generateGridParameters(
+        vec3i(64), 2.f, sphericalGridOrigin, sphericalGridSpacing);
+
+    auto v = rkcommon::make_unique<WaveletStructuredSphericalVolume<float>>(
+        vec3i(64), sphericalGridOrigin, sphericalGridSpacing);
+
+    interval_trange_updates(v->getVKLVolume());
+  }
+}
+
+// hits for the iso values 0.1, ..., 0.9 of a volume with value z on the unit
+// cube; the ray enters at t = 1, and the volume value along it is z = t - 1
+void hit_trange_updates(VKLVolume vklVolume)
+{
+  std::vector<float> isoValues;
+
+  for (float f = 0.1f; f < 1.f; f += 0.1f) {
+    isoValues.push_back(f);
+  }
+
+  VKLValueSelector valueSelector = vklNewValueSelector(vklVolume);
+  vklValueSelectorSetValues(valueSelector, isoValues.size(), isoValues.data());
+  vklCommit(valueSelector);
+
+  const float tCut = 1.45f;
+
+  std::vector<char> buffer(vklGetHitIteratorSize(vklVolume));
+
+  vkl_range1f tRange{0.f, inf};
+  VKLHitIterator iterator = vklInitHitIterator(vklVolume,
+                                               &rayOrigin,
+                                               &rayDirection,
+                                               &tRange,
+                                               valueSelector,
+                                               buffer.data());
+
+  std::vector<VKLHit> hits;
+
+  VKLHit hit;
+
+  SECTION("shrinking tRange.upper after the first hit")
+  {
+    REQUIRE(vklIterateHit(iterator, &hit));
+    hits.push_back(hit);
+
+    const vkl_range1f newTRange{0.f, tCut};
+    vklSetHitIteratorTRange(iterator, &newTRange);
+
+    while (vklIterateHit(iterator, &hit)) {
+      hits.push_back(hit);
+    }
+
+    // hits at 0.1, 0.2, 0.3 and 0.4
+    REQUIRE(hits.size() == 4);
+
+    for (size_t i = 0; i < hits.size(); i++) {
+      REQUIRE(hits[i].t == Approx(1.f + isoValues[i]).margin(1e-3f));
+      REQUIRE(hits[i].sample == isoValues[i]);
+    }
+  }
+
+  SECTION("advancing tRange.lower after the first hit")
+  {
+    REQUIRE(vklIterateHit(iterator, &hit));
+
+    const vkl_range1f newTRange{tCut, inf};
+    vklSetHitIteratorTRange(iterator, &newTRange);
+
+    while (vklIterateHit(iterator, &hit)) {
+      hits.push_back(hit);
+    }
+
+    // hits at 0.5 and beyond
+    REQUIRE(hits.size() == isoValues.size() - 4);
+
+    for (size_t i = 0; i < hits.size(); i++) {
+      REQUIRE(hits[i].t == Approx(1.f + isoValues[i + 4]).margin(1e-3f));
+      REQUIRE(hits[i].sample == isoValues[i + 4]);
+    }
+  }
+
+  vklRelease(valueSelector);
+}
+
+TEST_CASE("Hit iterator tRange updates", "[hit_iterators]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  const vec3i dimensions(128);
+  const vec3f gridOrigin(0.f);
+  const vec3f gridSpacing(1.f / (128.f - 1.f));
+
+  SECTION("structured volumes")
+  {
+    auto v = rkcommon::make_unique<ZProceduralVolume>(
+        dimensions, gridOrigin, gridSpacing);
+
+    hit_trange_updates(v->getVKLVolume());
+  }
+
+  // the following use the default hit iterator on top of their interval
+  // iterators
+
+  SECTION("unstructured volumes")
+  {
+    auto v = rkcommon::make_unique<ZUnstructuredProceduralVolume>(
+        dimensions, gridOrigin, gridSpacing, VKL_HEXAHEDRON, false);
+
+    hit_trange_updates(v->getVKLVolume());
+  }
+
+  SECTION("vdb volumes")
+  {
+    auto v = rkcommon::make_unique<ZVdbVolume>(
+        dimensions, gridOrigin, gridSpacing, VKL_FILTER_TRILINEAR);
+
+    hit_trange_updates(v->getVKLVolume());
+  }
+}
@@ -0,0 +1,68 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+#include "rkcommon/utility/multidim_index_sequence.h"
+#include "sampling_utility.h"
+
+using namespace rkcommon;
+using namespace openvkl::testing;
+
+template <typename VOLUME_TYPE>
+static void test_procedural_sampling(VOLUME_TYPE &volume)
+{
+  VKLSampler sampler = vklNewSampler(volume.getVKLVolume());
+  vklCommit(sampler);
+
+  const vec3i step(7);
+  multidim_index_sequence<3> mis(volume.getDimensions() / step);
+  for (const auto &offset : mis) {
+    const vec3f objectCoordinates =
+        volume.transformLocalToObjectCoordinates(offset * step);
+
+    INFO("objectCoordinates = " << objectCoordinates.x << " "
+                                << objectCoordinates.y << " "
+                                << objectCoordinates.z);
+
+    test_scalar_and_vector_sampling(
+        sampler,
+        objectCoordinates,
+        volume.computeProceduralValue(objectCoordinates),
+        1e-4f);
+  }
+
+  vklRelease(sampler);
+}
+
+TEST_CASE("NUMA policy", "[numa_policy]")
+{
+  vklLoadModule("ispc_driver");
+
+  const std::vector<std::string> policies{"none", "firstTouch", "interleave"};
+
+  for (const auto &policy : policies) {
+    DYNAMIC_SECTION("numaPolicy " << policy)
+    {
+      VKLDriver driver = vklNewDriver("ispc");
+      vklDriverSetString(driver, "numaPolicy", policy.c_str());
+      vklCommitDriver(driver);
+      vklSetCurrentDriver(driver);
+
+      // owned data arrays
+      WaveletStructuredRegularVolume<float> structured(
+          vec3i(128), vec3f(0.f), vec3f(1.f));
+      test_procedural_sampling(structured);
+
+      // VDB node arrays
+      WaveletVdbVolume vdb(128, vec3f(0.f), vec3f(1.f), VKL_FILTER_TRILINEAR);
+      test_procedural_sampling(vdb);
+    }
+  }
+
+  // restore the default for subsequent tests
+  VKLDriver driver = vklNewDriver("ispc");
+  vklDriverSetString(driver, "numaPolicy", "none");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+}
@@ -0,0 +1,93 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cmath>
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+
+using namespace rkcommon;
+using namespace openvkl::testing;
+
+static bool sameOrBothNaN(float a, float b)
+{
+  return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+template <typename VOLUME_TYPE>
+void test_sampler_functions()
+{
+  auto v =
+      rkcommon::make_unique<VOLUME_TYPE>(vec3i(128), vec3f(0.f), vec3f(1.f));
+
+  VKLVolume vklVolume   = v->getVKLVolume();
+  VKLSampler vklSampler = vklNewSampler(vklVolume);
+  vklCommit(vklSampler);
+
+  const VKLSamplerFunctions functions = vklGetSamplerFunctions(vklSampler);
+
+  REQUIRE(functions.computeSample != nullptr);
+  REQUIRE(functions.computeGradient != nullptr);
+
+  vkl_box3f bbox = vklGetBoundingBox(vklVolume);
+
+  std::random_device rd;
+  std::mt19937 eng(rd());
+
+  std::uniform_real_distribution<float> distX(bbox.lower.x, bbox.upper.x);
+  std::uniform_real_distribution<float> distY(bbox.lower.y, bbox.upper.y);
+  std::uniform_real_distribution<float> distZ(bbox.lower.z, bbox.upper.z);
+
+  for (int i = 0; i < 4096; i++) {
+    const vkl_vec3f oc{distX(eng), distY(eng), distZ(eng)};
+
+    INFO("objectCoordinates = " << oc.x << " " << oc.y << " " << oc.z);
+
+    const float sampleTruth = vklComputeSample(vklSampler, &oc);
+    const float sample      = functions.computeSample(vklSampler, &oc);
+
+    REQUIRE(sameOrBothNaN(sampleTruth, sample));
+
+    const vkl_vec3f gradientTruth = vklComputeGradient(vklSampler, &oc);
+    const vkl_vec3f gradient      = functions.computeGradient(vklSampler, &oc);
+
+    REQUIRE(sameOrBothNaN(gradientTruth.x, gradient.x));
+    REQUIRE(sameOrBothNaN(gradientTruth.y, gradient.y));
+    REQUIRE(sameOrBothNaN(gradientTruth.z, gradient.z));
+  }
+
+  vklRelease(vklSampler);
+}
+
+TEST_CASE("Direct sampler functions", "[volume_sampling]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  SECTION("AMR")
+  {
+    test_sampler_functions<ProceduralShellsAMRVolume<>>();
+  }
+
+  SECTION("structuredRegular")
+  {
+    test_sampler_functions<WaveletStructuredRegularVolume<float>>();
+  }
+
+  SECTION("structuredSpherical")
+  {
+    test_sampler_functions<WaveletStructuredSphericalVolume<float>>();
+  }
+
+  SECTION("unstructured")
+  {
+    test_sampler_functions<WaveletUnstructuredProceduralVolume>();
+  }
+
+  SECTION("VDB")
+  {
+    test_sampler_functions<WaveletVdbVolume>();
+  }
+}
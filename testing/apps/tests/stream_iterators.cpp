@@ -0,0 +1,286 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+
+using namespace rkcommon;
+using namespace openvkl::testing;
+
+struct StreamResults
+{
+  std::vector<std::vector<VKLInterval>> intervals;
+  std::vector<std::vector<VKLHit>> hits;
+  size_t maxPerRay{std::numeric_limits<size_t>::max()};
+};
+
+int collect_interval(void *userData,
+                     unsigned int rayIndex,
+                     const VKLInterval *interval)
+{
+  auto &results = *static_cast<StreamResults *>(userData);
+  results.intervals[rayIndex].push_back(*interval);
+  return results.intervals[rayIndex].size() < results.maxPerRay;
+}
+
+int collect_hit(void *userData, unsigned int rayIndex, const VKLHit *hit)
+{
+  auto &results = *static_cast<StreamResults *>(userData);
+  results.hits[rayIndex].push_back(*hit);
+  return results.hits[rayIndex].size() < results.maxPerRay;
+}
+
+// rays enter through the z = lower face of the bounding box, with varying
+// tilt so that they leave the volume after different numbers of intervals
+void random_rays(VKLVolume volume,
+                 size_t N,
+                 std::vector<vkl_vec3f> &origins,
+                 std::vector<vkl_vec3f> &directions)
+{
+  const vkl_box3f bbox = vklGetBoundingBox(volume);
+
+  std::random_device rd;
+  std::mt19937 eng(rd());
+
+  std::uniform_real_distribution<float> distX(bbox.lower.x, bbox.upper.x);
+  std::uniform_real_distribution<float> distY(bbox.lower.y, bbox.upper.y);
+  std::uniform_real_distribution<float> distTilt(-1.f, 1.f);
+
+  origins.resize(N);
+  directions.resize(N);
+
+  for (size_t i = 0; i < N; i++) {
+    origins[i] = vkl_vec3f{distX(eng), distY(eng), bbox.lower.z - 1.f};
+    const vec3f d = normalize(vec3f(distTilt(eng), distTilt(eng), 1.f));
+    directions[i] = vkl_vec3f{d.x, d.y, d.z};
+  }
+}
+
+void stream_intervals_cover_scalar_intervals(VKLVolume volume)
+{
+  for (size_t N : {1, 7, 64, 257}) {
+    std::vector<vkl_vec3f> origins;
+    std::vector<vkl_vec3f> directions;
+    random_rays(volume, N, origins, directions);
+
+    std::vector<vkl_range1f> tRanges(N, vkl_range1f{0.f, inf});
+
+    StreamResults results;
+    results.intervals.resize(N);
+
+    vklIterateIntervalN(volume,
+                        N,
+                        origins.data(),
+                        directions.data(),
+                        tRanges.data(),
+                        nullptr,
+                        collect_interval,
+                        &results);
+
+    std::vector<char> buffer(vklGetIntervalIteratorSize(volume));
+
+    for (size_t i = 0; i < N; i++) {
+      VKLIntervalIterator iterator = vklInitIntervalIterator(volume,
+                                                             &origins[i],
+                                                             &directions[i],
+                                                             &tRanges[i],
+                                                             nullptr,
+                                                             buffer.data());
+
+      std::vector<VKLInterval> scalarIntervals;
+
+      VKLInterval interval;
+      while (vklIterateInterval(iterator, &interval)) {
+        scalarIntervals.push_back(interval);
+      }
+
+      const std::vector<VKLInterval> &streamIntervals = results.intervals[i];
+
+      INFO("ray " << i << " / " << N);
+
+      if (scalarIntervals.empty()) {
+        REQUIRE(streamIntervals.empty());
+        continue;
+      }
+
+      REQUIRE(!streamIntervals.empty());
+
+      // regrouping may split intervals differently, but the stream must
+      // cover the same t range without gaps
+      REQUIRE(streamIntervals.front().tRange.lower ==
+              Approx(scalarIntervals.front().tRange.lower).margin(1e-5f));
+      REQUIRE(streamIntervals.back().tRange.upper ==
+              Approx(scalarIntervals.back().tRange.upper).margin(1e-5f));
+
+      for (size_t j = 0; j < streamIntervals.size(); j++) {
+        REQUIRE(streamIntervals[j].tRange.lower <
+                streamIntervals[j].tRange.upper);
+
+        if (j > 0) {
+          REQUIRE(streamIntervals[j].tRange.lower ==
+                  Approx(streamIntervals[j - 1].tRange.upper).margin(1e-5f));
+        }
+      }
+    }
+  }
+}
+
+void stream_intervals_early_termination(VKLVolume volume)
+{
+  const size_t N = 100;
+
+  std::vector<vkl_vec3f> origins;
+  std::vector<vkl_vec3f> directions;
+  random_rays(volume, N, origins, directions);
+
+  std::vector<vkl_range1f> tRanges(N, vkl_range1f{0.f, inf});
+
+  StreamResults results;
+  results.intervals.resize(N);
+  results.maxPerRay = 1;
+
+  vklIterateIntervalN(volume,
+                      N,
+                      origins.data(),
+                      directions.data(),
+                      tRanges.data(),
+                      nullptr,
+                      collect_interval,
+                      &results);
+
+  for (size_t i = 0; i < N; i++) {
+    INFO("ray " << i);
+    REQUIRE(results.intervals[i].size() <= 1);
+  }
+}
+
+TEST_CASE("Stream interval iterator", "[interval_iterators]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  // for a unit cube physical grid [(0,0,0), (1,1,1)]
+  const vec3i dimensions(128);
+  const vec3f gridOrigin(0.f);
+  const vec3f gridSpacing(1.f / (128.f - 1.f));
+
+  SECTION("structured volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletStructuredRegularVolume<float>>(
+        dimensions, gridOrigin, gridSpacing);
+
+    VKLVolume vklVolume = v->getVKLVolume();
+
+    SECTION("stream intervals cover scalar intervals")
+    {
+      stream_intervals_cover_scalar_intervals(vklVolume);
+    }
+
+    SECTION("stream intervals early termination")
+    {
+      stream_intervals_early_termination(vklVolume);
+    }
+  }
+
+  SECTION("unstructured volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletUnstructuredProceduralVolume>(
+        dimensions, gridOrigin, gridSpacing, VKL_HEXAHEDRON, false);
+
+    VKLVolume vklVolume = v->getVKLVolume();
+
+    stream_intervals_cover_scalar_intervals(vklVolume);
+  }
+
+  SECTION("vdb volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletVdbVolume>(
+        dimensions, gridOrigin, gridSpacing);
+
+    VKLVolume vklVolume = v->getVKLVolume();
+
+    stream_intervals_cover_scalar_intervals(vklVolume);
+  }
+}
+
+TEST_CASE("Stream hit iterator", "[hit_iterators]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  const vec3i dimensions(128);
+  const vec3f gridOrigin(0.f);
+  const vec3f gridSpacing(1.f / (128.f - 1.f));
+
+  std::unique_ptr<ZProceduralVolume> v(
+      new ZProceduralVolume(dimensions, gridOrigin, gridSpacing));
+
+  VKLVolume vklVolume = v->getVKLVolume();
+
+  std::vector<float> isoValues;
+
+  for (float f = 0.1f; f < 1.f; f += 0.1f) {
+    isoValues.push_back(f);
+  }
+
+  VKLValueSelector valueSelector = vklNewValueSelector(vklVolume);
+  vklValueSelectorSetValues(valueSelector, isoValues.size(), isoValues.data());
+  vklCommit(valueSelector);
+
+  const size_t N = 257;
+
+  std::vector<vkl_vec3f> origins;
+  std::vector<vkl_vec3f> directions;
+  random_rays(vklVolume, N, origins, directions);
+
+  std::vector<vkl_range1f> tRanges(N, vkl_range1f{0.f, inf});
+
+  StreamResults results;
+  results.hits.resize(N);
+
+  vklIterateHitN(vklVolume,
+                 N,
+                 origins.data(),
+                 directions.data(),
+                 tRanges.data(),
+                 valueSelector,
+                 collect_hit,
+                 &results);
+
+  std::vector<char> buffer(vklGetHitIteratorSize(vklVolume));
+
+  for (size_t i = 0; i < N; i++) {
+    VKLHitIterator iterator = vklInitHitIterator(vklVolume,
+                                                 &origins[i],
+                                                 &directions[i],
+                                                 &tRanges[i],
+                                                 valueSelector,
+                                                 buffer.data());
+
+    std::vector<VKLHit> scalarHits;
+
+    VKLHit hit;
+    while (vklIterateHit(iterator, &hit)) {
+      scalarHits.push_back(hit);
+    }
+
+    const std::vector<VKLHit> &streamHits = results.hits[i];
+
+    INFO("ray " << i << " / " << N);
+
+    REQUIRE(streamHits.size() == scalarHits.size());
+
+    for (size_t j = 0; j < streamHits.size(); j++) {
+      REQUIRE(streamHits[j].t == Approx(scalarHits[j].t).margin(1e-3f));
+      REQUIRE(streamHits[j].sample == scalarHits[j].sample);
+    }
+  }
+
+  vklRelease(valueSelector);
+}
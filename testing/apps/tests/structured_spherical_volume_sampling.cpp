@@ -61,6 +61,113 @@ void sampling_on_interior_vertices_vs_procedural_values(vec3i dimensions,
   vklRelease(vklSampler);
 }
 
+// samples a volume whose voxel values are the voxel index along the given
+// dimension, so that samples reproduce the local (r, inclination, azimuth)
+// coordinate computed by the transform
+std::vector<float> sample_local_coordinate(const vec3i &dimensions,
+                                           const vec3f &gridOrigin,
+                                           const vec3f &gridSpacing,
+                                           int dimension,
+                                           bool approximateTransform,
+                                           const std::vector<vec3f> &points)
+{
+  std::vector<float> voxels(dimensions.long_product());
+
+  multidim_index_sequence<3> mis(dimensions);
+
+  for (const auto &index : mis) {
+    const size_t i =
+        index.x + dimensions.x * (index.y + size_t(dimensions.y) * index.z);
+    voxels[i] = index[dimension];
+  }
+
+  VKLVolume volume = vklNewVolume("structuredSpherical");
+  VKLData data     = vklNewData(voxels.size(), VKL_FLOAT, voxels.data());
+
+  vklSetVec3i(volume, "dimensions", dimensions.x, dimensions.y, dimensions.z);
+  vklSetVec3f(volume, "gridOrigin", gridOrigin.x, gridOrigin.y, gridOrigin.z);
+  vklSetVec3f(
+      volume, "gridSpacing", gridSpacing.x, gridSpacing.y, gridSpacing.z);
+  vklSetData(volume, "data", data);
+  vklSetBool(volume, "approximateTransform", approximateTransform);
+  vklCommit(volume);
+  vklRelease(data);
+
+  VKLSampler sampler = vklNewSampler(volume);
+  vklCommit(sampler);
+
+  // scalar samples exercise the uniform transform, streams the varying one
+  std::vector<float> samples(2 * points.size());
+
+  for (size_t i = 0; i < points.size(); i++) {
+    samples[i] = vklComputeSample(sampler, (const vkl_vec3f *)&points[i]);
+  }
+
+  vklComputeSampleN(sampler,
+                    points.size(),
+                    (const vkl_vec3f *)points.data(),
+                    samples.data() + points.size());
+
+  vklRelease(sampler);
+  vklRelease(volume);
+
+  return samples;
+}
+
+void approximate_transform_error_bounds(const vec3i &dimensions)
+{
+  constexpr float epsilon = std::numeric_limits<float>::epsilon();
+
+  const vec3f gridOrigin(0.f);
+  const vec3f gridSpacing(1.f / (dimensions.x - 1),
+                          180.f / (dimensions.y - 1) - epsilon,
+                          360.f / (dimensions.z - 1) - epsilon);
+
+  const float degToRad = M_PI / 180.f;
+  const vec3f gridSpacingRadians =
+      gridSpacing * vec3f(1.f, degToRad, degToRad);
+
+  // points throughout the interior of the grid, including all octants and
+  // near the azimuth seam. points very close to the poles are avoided, where
+  // acos() in the exact transform is itself ill-conditioned.
+  std::vector<vec3f> points;
+
+  multidim_index_sequence<3> mis(vec3i(7, 23, 37));
+
+  for (const auto &index : mis) {
+    const float r           = 0.1f + 0.13f * index.x;
+    const float inclination = (2.f + 176.f * index.y / 22.f) * degToRad;
+    const float azimuth     = (0.5f + 359.f * index.z / 36.f) * degToRad;
+
+    points.emplace_back(r * std::sin(inclination) * std::cos(azimuth),
+                        r * std::sin(inclination) * std::sin(azimuth),
+                        r * std::cos(inclination));
+  }
+
+  // documented bound, in object units for r and radians for the angles
+  const float maxError = 1e-5f;
+
+  for (int d = 0; d < 3; d++) {
+    const std::vector<float> exact = sample_local_coordinate(
+        dimensions, gridOrigin, gridSpacing, d, false, points);
+    const std::vector<float> approximate = sample_local_coordinate(
+        dimensions, gridOrigin, gridSpacing, d, true, points);
+
+    for (size_t i = 0; i < exact.size(); i++) {
+      const vec3f &p = points[i % points.size()];
+
+      INFO("dimension = " << d);
+      INFO("objectCoordinates = " << p.x << " " << p.y << " " << p.z);
+      INFO("exact = " << exact[i] << ", approximate = " << approximate[i]);
+
+      const float error =
+          std::abs(approximate[i] - exact[i]) * gridSpacingRadians[d];
+
+      REQUIRE(error <= maxError);
+    }
+  }
+}
+
 TEST_CASE("Structured spherical volume sampling", "[volume_sampling]")
 {
   vklLoadModule("ispc_driver");
@@ -148,3 +255,15 @@ TEST_CASE("Structured spherical volume sampling", "[volume_sampling]")
                                                 vec3i(16, 16, 1));
   }
 }
+
+TEST_CASE("Structured spherical volume approximate transform",
+          "[volume_sampling]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  approximate_transform_error_bounds(vec3i(64));
+}
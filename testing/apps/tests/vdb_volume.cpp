@@ -355,3 +355,69 @@ TEST_CASE("VDB volume strides", "[volume_strides]")
     }
   }
 }
+
+TEST_CASE("VDB volume mixed leaf strides", "[volume_strides]")
+{
+  init_driver();
+
+  const uint32_t level   = vklVdbNumLevels() - 1;
+  const uint32_t res     = vklVdbLevelRes(level);
+  const size_t numVoxels = vklVdbLevelNumVoxels(level);
+
+  // compact leaves sampled through direct pointers, and strided and unaligned
+  // shared leaves sampled through Data1D, all in the same tree
+  std::vector<float> compact(numVoxels, 1.f);
+  std::vector<float> strided(2 * numVoxels, 2.f);
+  std::vector<float> unaligned(numVoxels + 4, 3.f);
+
+  std::vector<VKLData> leaves;
+  leaves.push_back(vklNewData(numVoxels, VKL_FLOAT, compact.data()));
+  leaves.push_back(vklNewData(numVoxels,
+                              VKL_FLOAT,
+                              strided.data(),
+                              VKL_DATA_SHARED_BUFFER,
+                              2 * sizeof(float)));
+  leaves.push_back(vklNewData(numVoxels,
+                              VKL_FLOAT,
+                              unaligned.data() + 1,
+                              VKL_DATA_SHARED_BUFFER));
+
+  std::vector<uint32_t> levels(leaves.size(), level);
+  std::vector<uint32_t> formats(leaves.size(), VKL_FORMAT_CONSTANT_ZYX);
+  std::vector<vec3i> origins;
+  for (size_t i = 0; i < leaves.size(); i++)
+    origins.push_back(vec3i(int(i * res), 0, 0));
+
+  VKLVolume volume = vklNewVolume("vdb");
+
+  VKLData levelData = vklNewData(levels.size(), VKL_UINT, levels.data());
+  vklSetData(volume, "node.level", levelData);
+  vklRelease(levelData);
+  VKLData originData = vklNewData(origins.size(), VKL_VEC3I, origins.data());
+  vklSetData(volume, "node.origin", originData);
+  vklRelease(originData);
+  VKLData formatData = vklNewData(formats.size(), VKL_UINT, formats.data());
+  vklSetData(volume, "node.format", formatData);
+  vklRelease(formatData);
+  VKLData dataData = vklNewData(leaves.size(), VKL_DATA, leaves.data());
+  vklSetData(volume, "node.data", dataData);
+  vklRelease(dataData);
+  for (VKLData leaf : leaves)
+    vklRelease(leaf);
+
+  vklCommit(volume);
+
+  VKLSampler sampler = vklNewSampler(volume);
+  vklCommit(sampler);
+
+  for (size_t i = 0; i < leaves.size(); i++) {
+    const vec3f objectCoordinates((i + 0.5f) * res, 0.5f * res, 0.5f * res);
+
+    INFO("leaf = " << i);
+    test_scalar_and_vector_sampling(
+        sampler, objectCoordinates, float(i + 1), 0.f);
+  }
+
+  vklRelease(sampler);
+  vklRelease(volume);
+}
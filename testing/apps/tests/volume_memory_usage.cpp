@@ -0,0 +1,121 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+
+using namespace rkcommon;
+using namespace openvkl::testing;
+
+static void check_memory_usage(VKLVolume volume)
+{
+  const VKLMemoryUsage usage = vklGetVolumeMemoryUsage(volume);
+
+  INFO("data = " << usage.data << ", accelerator = " << usage.accelerator
+                 << ", auxiliary = " << usage.auxiliary);
+
+  REQUIRE(usage.accelerator > 0);
+  REQUIRE(usage.total == usage.data + usage.accelerator + usage.auxiliary);
+}
+
+TEST_CASE("Volume memory usage", "[volume_memory_usage]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  const vec3i dimensions(128);
+  const vec3f gridOrigin(0.f);
+  const vec3f gridSpacing(1.f);
+
+  SECTION("structured volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletStructuredRegularVolume<float>>(
+        dimensions, gridOrigin, gridSpacing);
+
+    VKLVolume vklVolume = v->getVKLVolume();
+    check_memory_usage(vklVolume);
+
+    // voxel data was copied into the volume
+    REQUIRE(vklGetVolumeMemoryUsage(vklVolume).data >=
+            dimensions.long_product() * sizeof(float));
+  }
+
+  SECTION("structured volumes with shared voxel data")
+  {
+    auto v = rkcommon::make_unique<WaveletStructuredRegularVolume<float>>(
+        dimensions, gridOrigin, gridSpacing, VKL_DATA_SHARED_BUFFER);
+
+    VKLVolume vklVolume = v->getVKLVolume();
+    check_memory_usage(vklVolume);
+
+    REQUIRE(vklGetVolumeMemoryUsage(vklVolume).data == 0);
+  }
+
+  SECTION("unstructured volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletUnstructuredProceduralVolume>(
+        vec3i(32), gridOrigin, gridSpacing, VKL_HEXAHEDRON, false);
+
+    check_memory_usage(v->getVKLVolume());
+  }
+
+  SECTION("particle volumes")
+  {
+    auto v = rkcommon::make_unique<ProceduralParticleVolume>(1000);
+
+    check_memory_usage(v->getVKLVolume());
+  }
+
+  SECTION("amr volumes")
+  {
+    auto v = rkcommon::make_unique<ProceduralShellsAMRVolume<>>(
+        dimensions, gridOrigin, gridSpacing);
+
+    check_memory_usage(v->getVKLVolume());
+  }
+
+  SECTION("vdb volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletVdbVolume>(
+        dimensions, gridOrigin, gridSpacing);
+
+    check_memory_usage(v->getVKLVolume());
+  }
+
+  SECTION("driver totals follow volume lifetime")
+  {
+    const size_t totalBefore = vklGetTotalVolumeMemoryUsage().total;
+
+    auto v = rkcommon::make_unique<WaveletStructuredRegularVolume<float>>(
+        dimensions, gridOrigin, gridSpacing);
+
+    const VKLMemoryUsage usage = vklGetVolumeMemoryUsage(v->getVKLVolume());
+
+    REQUIRE(vklGetTotalVolumeMemoryUsage().total ==
+            totalBefore + usage.total);
+
+    v.reset();
+
+    REQUIRE(vklGetTotalVolumeMemoryUsage().total == totalBefore);
+  }
+
+  SECTION("driver totals are per driver")
+  {
+    VKLDriver otherDriver = vklNewDriver("ispc");
+    vklCommitDriver(otherDriver);
+
+    auto v = rkcommon::make_unique<WaveletStructuredRegularVolume<float>>(
+        dimensions, gridOrigin, gridSpacing);
+
+    REQUIRE(vklGetVolumeMemoryUsage(v->getVKLVolume()).total > 0);
+
+    // the volume was created by the first driver, of the same width
+    vklSetCurrentDriver(otherDriver);
+    REQUIRE(vklGetTotalVolumeMemoryUsage().total == 0);
+
+    vklSetCurrentDriver(driver);
+  }
+}
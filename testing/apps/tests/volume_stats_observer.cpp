@@ -0,0 +1,128 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../../external/catch.hpp"
+#include "openvkl_testing.h"
+
+using namespace rkcommon;
+using namespace openvkl::testing;
+
+static std::vector<uint64_t> map_stats(VKLObserver observer)
+{
+  const uint64_t *counters =
+      static_cast<const uint64_t *>(vklMapObserver(observer));
+  REQUIRE(counters);
+
+  REQUIRE(vklGetObserverElementType(observer) == VKL_ULONG);
+  REQUIRE(vklGetObserverNumElements(observer) == VKL_STATS_NUM_COUNTERS);
+
+  std::vector<uint64_t> stats(counters, counters + VKL_STATS_NUM_COUNTERS);
+  vklUnmapObserver(observer);
+
+  return stats;
+}
+
+static void stats_observer(VKLVolume volume)
+{
+  VKLObserver observer = vklNewObserver(volume, "Stats");
+  REQUIRE(observer);
+
+  const std::vector<uint64_t> before = map_stats(observer);
+
+  VKLSampler sampler = vklNewSampler(volume);
+  vklCommit(sampler);
+
+  const vkl_box3f bbox = vklGetBoundingBox(volume);
+  const vkl_vec3f center{0.5f * (bbox.lower.x + bbox.upper.x),
+                         0.5f * (bbox.lower.y + bbox.upper.y),
+                         0.5f * (bbox.lower.z + bbox.upper.z)};
+
+  const uint64_t numSamples = 100;
+  for (uint64_t i = 0; i < numSamples; i++)
+    vklComputeSample(sampler, &center);
+
+  vklComputeGradient(sampler, &center);
+
+  const vkl_vec3f rayOrigin{center.x, center.y, bbox.lower.z - 1.f};
+  const vkl_vec3f rayDirection{0.f, 0.f, 1.f};
+  vkl_range1f tRange{0.f, inf};
+
+  std::vector<char> buffer(vklGetIntervalIteratorSize(volume));
+  VKLIntervalIterator iterator = vklInitIntervalIterator(
+      volume, &rayOrigin, &rayDirection, &tRange, nullptr, buffer.data());
+
+  uint64_t numIntervals = 0;
+
+  VKLInterval interval;
+  while (vklIterateInterval(iterator, &interval))
+    numIntervals++;
+
+  const std::vector<uint64_t> after = map_stats(observer);
+
+  REQUIRE(after[VKL_STATS_SAMPLES] - before[VKL_STATS_SAMPLES] == numSamples);
+  REQUIRE(after[VKL_STATS_GRADIENTS] - before[VKL_STATS_GRADIENTS] == 1);
+  REQUIRE(numIntervals > 0);
+  REQUIRE(after[VKL_STATS_INTERVALS] - before[VKL_STATS_INTERVALS] ==
+          numIntervals);
+
+  // a second observer shares the counters of the first
+  VKLObserver second = vklNewObserver(volume, "Stats");
+  REQUIRE(second);
+  REQUIRE(map_stats(second) == after);
+
+  // counting stops once the last observer is released, and resumes from the
+  // previous totals with a new observer
+  vklRelease(second);
+  vklRelease(observer);
+
+  for (uint64_t i = 0; i < numSamples; i++)
+    vklComputeSample(sampler, &center);
+
+  VKLObserver third = vklNewObserver(volume, "Stats");
+  REQUIRE(third);
+  REQUIRE(map_stats(third) == after);
+
+  vklComputeSample(sampler, &center);
+  REQUIRE(map_stats(third)[VKL_STATS_SAMPLES] ==
+          after[VKL_STATS_SAMPLES] + 1);
+
+  vklRelease(third);
+  vklRelease(sampler);
+}
+
+TEST_CASE("Volume stats observer", "[volume_observers]")
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  const vec3i dimensions(32);
+  const vec3f gridOrigin(0.f);
+  const vec3f gridSpacing(1.f);
+
+  SECTION("structured volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletStructuredRegularVolume<float>>(
+        dimensions, gridOrigin, gridSpacing);
+
+    stats_observer(v->getVKLVolume());
+  }
+
+  SECTION("unstructured volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletUnstructuredProceduralVolume>(
+        dimensions, gridOrigin, gridSpacing, VKL_HEXAHEDRON, false);
+
+    stats_observer(v->getVKLVolume());
+  }
+
+  SECTION("vdb volumes")
+  {
+    auto v = rkcommon::make_unique<WaveletVdbVolume>(
+        dimensions, gridOrigin, gridSpacing);
+
+    stats_observer(v->getVKLVolume());
+  }
+}
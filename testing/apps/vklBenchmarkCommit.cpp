@@ -0,0 +1,28 @@
+// Copyright 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "benchmark/benchmark.h"
+#include "benchmark_suite/commit.h"
+#include "openvkl_testing.h"
+
+// based on BENCHMARK_MAIN() macro from benchmark.h
+int main(int argc, char **argv)
+{
+  vklLoadModule("ispc_driver");
+
+  VKLDriver driver = vklNewDriver("ispc");
+  vklCommitDriver(driver);
+  vklSetCurrentDriver(driver);
+
+  registerCommitBenchmarks();
+
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  vklShutdown();
+
+  return 0;
+}